@@ -0,0 +1,58 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// 근접/스킬 RPC·복제 공용 양자화 헬퍼
+namespace CombatNet
+{
+    // 타임스탬프 양자화: 서버 월드 시간(ms) 하위 16비트 (약 65초 주기, 수신 측 현재 시각 기준 복원)
+    inline uint16 QuantizeTime(float Seconds) { return (uint16)(FMath::FloorToInt64(Seconds * 1000.0) & 0xFFFF); }
+    inline float DequantizeTime(uint16 Quantized, float Now)
+    {
+        const uint16 AgeMs = (uint16)(QuantizeTime(Now) - Quantized);
+        return Now - AgeMs * 0.001f;
+    }
+
+    // 미래/과거 양쪽 시각(쿨다운 종료 등): 10ms 단위 하위 16비트, 현재 기준 ±327초 안에서 복원
+    inline uint16 QuantizeTimeCs(float Seconds) { return (uint16)(FMath::FloorToInt64(Seconds * 100.0) & 0xFFFF); }
+    inline float DequantizeTimeCs(uint16 Quantized, float Now)
+    {
+        const int16 DeltaCs = (int16)(uint16)(Quantized - QuantizeTimeCs(Now));
+        return Now + DeltaCs * 0.01f;
+    }
+
+    // 방향: 요 12비트 + 피치 10비트 (약 0.09도 / 0.18도)
+    constexpr int32 YawBits = 12;
+    constexpr int32 PitchBits = 10;
+
+    inline void QuantizeDirection(const FVector& Dir, uint16& OutYaw, uint16& OutPitch)
+    {
+        const FRotator Rot = Dir.Rotation();
+        OutYaw = (uint16)(FMath::RoundToInt(FRotator::ClampAxis(Rot.Yaw) / 360.f * (1 << YawBits)) & ((1 << YawBits) - 1));
+        OutPitch = (uint16)FMath::Clamp(FMath::RoundToInt((FRotator::NormalizeAxis(Rot.Pitch) + 90.f) / 180.f * ((1 << PitchBits) - 1)), 0, (1 << PitchBits) - 1);
+    }
+
+    inline FVector DequantizeDirection(uint16 Yaw, uint16 Pitch)
+    {
+        const float YawDeg = Yaw * 360.f / (1 << YawBits);
+        const float PitchDeg = Pitch * 180.f / ((1 << PitchBits) - 1) - 90.f;
+        return FRotator(PitchDeg, YawDeg, 0.f).Vector();
+    }
+
+    // 스탯 값: 0.01 단위 고정소수점 → 지그재그 → SerializeIntPacked (절댓값이 작을수록 바이트 수가 적다)
+    constexpr float StatScale = 100.f;
+    inline int32 QuantizeStat(float Value) { return FMath::RoundToInt(FMath::Clamp(Value, -2.0e7f, 2.0e7f) * StatScale); }
+    inline float DequantizeStat(int32 Quantized) { return Quantized / StatScale; }
+
+    inline uint32 ZigZag(int32 Value) { return ((uint32)Value << 1) ^ (uint32)(Value >> 31); }
+    inline int32 UnZigZag(uint32 Value) { return (int32)(Value >> 1) ^ -(int32)(Value & 1); }
+
+    inline void SerializeQuantizedStat(FArchive& Ar, int32& Quantized)
+    {
+        uint32 Packed = ZigZag(Quantized);
+        Ar.SerializeIntPacked(Packed);
+        Quantized = UnZigZag(Packed);
+    }
+}
@@ -0,0 +1,28 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "CombatStats.h"
+
+DEFINE_STAT(STAT_CombatMeleeTracePass);
+DEFINE_STAT(STAT_CombatMeleeGather);
+DEFINE_STAT(STAT_CombatMeleeSweepSegment);
+DEFINE_STAT(STAT_CombatMeleeExecute);
+DEFINE_STAT(STAT_CombatMeleeHandleHit);
+DEFINE_STAT(STAT_CombatMeleeUpdatePhase);
+DEFINE_STAT(STAT_CombatSkillActivate);
+DEFINE_STAT(STAT_CombatSkillActivateBatch);
+DEFINE_STAT(STAT_CombatCooldownWheel);
+DEFINE_STAT(STAT_CombatPartyAssistScheduler);
+
+DEFINE_STAT(STAT_CombatActiveTracers);
+DEFINE_STAT(STAT_CombatSweeps);
+DEFINE_STAT(STAT_CombatAsyncSweeps);
+DEFINE_STAT(STAT_CombatHitBufferAllocs);
+DEFINE_STAT(STAT_CombatHits);
+DEFINE_STAT(STAT_CombatDamageEvents);
+DEFINE_STAT(STAT_CombatSkillSpawns);
+DEFINE_STAT(STAT_CombatSkillPoolHits);
+DEFINE_STAT(STAT_CombatSkillPoolMisses);
+DEFINE_STAT(STAT_CombatCooldownsExpired);
+DEFINE_STAT(STAT_CombatPartyAssistPawns);
+DEFINE_STAT(STAT_CombatPartyAssistThrottled);
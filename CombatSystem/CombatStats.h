@@ -0,0 +1,50 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/MiscTrace.h"
+
+// 전투 컴포넌트 공용 통계 그룹 (stat Combat / Unreal Insights)
+DECLARE_STATS_GROUP(TEXT("Combat"), STATGROUP_Combat, STATCAT_Advanced);
+
+// 사이클 카운터
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Melee Trace Pass"), STAT_CombatMeleeTracePass, STATGROUP_Combat, PROJECT_NAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Melee Gather Sweeps"), STAT_CombatMeleeGather, STATGROUP_Combat, PROJECT_NAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Melee Sweep Segment"), STAT_CombatMeleeSweepSegment, STATGROUP_Combat, PROJECT_NAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Melee Execute Sweeps"), STAT_CombatMeleeExecute, STATGROUP_Combat, PROJECT_NAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Melee Handle Hit"), STAT_CombatMeleeHandleHit, STATGROUP_Combat, PROJECT_NAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Melee Update Phase"), STAT_CombatMeleeUpdatePhase, STATGROUP_Combat, PROJECT_NAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Skill Activate"), STAT_CombatSkillActivate, STATGROUP_Combat, PROJECT_NAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Skill Activate Batch"), STAT_CombatSkillActivateBatch, STATGROUP_Combat, PROJECT_NAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Cooldown Wheel"), STAT_CombatCooldownWheel, STATGROUP_Combat, PROJECT_NAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Party Assist Scheduler"), STAT_CombatPartyAssistScheduler, STATGROUP_Combat, PROJECT_NAME_API);
+
+// 프레임 카운터 (매 프레임 자동 초기화)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Active Tracers"), STAT_CombatActiveTracers, STATGROUP_Combat, PROJECT_NAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Sweeps Issued"), STAT_CombatSweeps, STATGROUP_Combat, PROJECT_NAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Async Sweeps Issued"), STAT_CombatAsyncSweeps, STATGROUP_Combat, PROJECT_NAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Hit Buffer Allocs"), STAT_CombatHitBufferAllocs, STATGROUP_Combat, PROJECT_NAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Hits"), STAT_CombatHits, STATGROUP_Combat, PROJECT_NAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Damage Events"), STAT_CombatDamageEvents, STATGROUP_Combat, PROJECT_NAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Skill Spawns"), STAT_CombatSkillSpawns, STATGROUP_Combat, PROJECT_NAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Skill Pool Hits"), STAT_CombatSkillPoolHits, STATGROUP_Combat, PROJECT_NAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Skill Pool Misses"), STAT_CombatSkillPoolMisses, STATGROUP_Combat, PROJECT_NAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Cooldowns Expired"), STAT_CombatCooldownsExpired, STATGROUP_Combat, PROJECT_NAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Party Assist Pawns"), STAT_CombatPartyAssistPawns, STATGROUP_Combat, PROJECT_NAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Party Assist Throttled"), STAT_CombatPartyAssistThrottled, STATGROUP_Combat, PROJECT_NAME_API);
+
+// 사이클 카운터 + Insights CPU 스코프를 한 번에
+#define COMBAT_SCOPE(StatId) \
+    SCOPE_CYCLE_COUNTER(StatId); \
+    TRACE_CPUPROFILER_EVENT_SCOPE(StatId)
+
+// Insights 북마크 (공격 이름/액터 등). 채널이 꺼져 있으면 인자 포맷도 하지 않음
+#if UE_TRACE_ENABLED
+#define COMBAT_TRACE_EVENT(Format, ...) \
+    do { if (UE_TRACE_CHANNELEXPR_IS_ENABLED(BookmarkChannel)) { TRACE_BOOKMARK(Format, ##__VA_ARGS__); } } while (0)
+#else
+#define COMBAT_TRACE_EVENT(Format, ...) do { } while (0)
+#endif
@@ -2,14 +2,47 @@
 
 
 #include "MeeleAttackComponent.h"
+#include "MeleeAttackTimeline.h"
+#include "CombatStats.h"
 #include "GameFramework/Actor.h"
 #include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/GameStateBase.h"
+#include "Net/UnrealNetwork.h"
+#include "TimerManager.h"
+
+bool FMeleeAttackNetRequest::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    Ar.SerializeBits(&AttackIndex, MeleeNet::AttackIndexBits);
+    Ar << InputSeq;
+    Ar << StartTimeMs;
+    bOutSuccess = true;
+    return true;
+}
+
+bool FMeleeAttackRepState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    Ar.SerializeBits(&AttackIndex, MeleeNet::AttackIndexBits);
+    Ar.SerializeBits(&Phase, 2);
+    Ar << PhaseStartMs;
+    bOutSuccess = true;
+    return true;
+}
 
 
 UMeeleAttackComponent::UMeeleAttackComponent()
 {
+    // Idle 비용 0: 페이즈 전환은 타이머, 틱은 반경 커브 샘플링이 필요할 때만
     PrimaryComponentTick.bCanEverTick = true;
-    SetComponentTickEnabled(true);
+    PrimaryComponentTick.bStartWithTickEnabled = false;
+    SetIsReplicatedByDefault(true);
+}
+
+void UMeeleAttackComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+    // 소유 클라이언트는 예측하므로 제외
+    DOREPLIFETIME_CONDITION(UMeeleAttackComponent, RepState, COND_SkipOwner);
 }
 
 void UMeeleAttackComponent::BeginPlay()
@@ -23,18 +56,137 @@ void UMeeleAttackComponent::BeginPlay()
     }
     if (Tracer)
     {
+        // 고정 스텝 모드에선 서브시스템 프레임 패스 대신 이 컴포넌트가 스텝마다 스윕
+        Tracer->bExternallyStepped = bUseFixedStepClock;
         Tracer->OnHit.AddDynamic(this, &UMeeleAttackComponent::OnTracerHit);
         // 트레이서는 기본적으로 비활성. AttackComponent가 창을 열 때만 StartTrace/StopTrace
     }
 }
 
+void UMeeleAttackComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(PhaseTimer);
+    }
+    Super::EndPlay(EndPlayReason);
+}
+
+float UMeeleAttackComponent::GetPhaseElapsed() const
+{
+    return bUseFixedStepClock ? (SimStep - PhaseStartStep) * GetStepSeconds() : GetWorldTime() - PhaseStartTime;
+}
+
+float UMeeleAttackComponent::GetWorldTime() const
+{
+    const UWorld* World = GetWorld();
+    return World ? World->GetTimeSeconds() : 0.f;
+}
+
+bool UMeeleAttackComponent::CanRunTracer() const
+{
+    return GetOwnerRole() != ROLE_SimulatedProxy;
+}
+
+bool UMeeleAttackComponent::IsPredictingClient() const
+{
+    const APawn* Pawn = Cast<APawn>(GetOwner());
+    return bServerAuthoritative && Pawn && !Pawn->HasAuthority() && Pawn->IsLocallyControlled();
+}
+
+float UMeeleAttackComponent::GetNetTime() const
+{
+    const UWorld* World = GetWorld();
+    if (!World) return 0.f;
+    const AGameStateBase* GS = World->GetGameState();
+    return GS ? GS->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
+}
+
 void UMeeleAttackComponent::RequestAttack()
+{
+    const int32 RequestedIndex = ResolveRequestedIndex();
+    const bool bWasIdle = Phase == EAttackPhase::Idle;
+    const bool bWasBuffered = bBufferedNext;
+
+    // 고정 스텝: 서버로 보낼 스탬프와 같은 정수 ms에서 시작 스텝을 얻어 서버와 같은 스텝에 고정
+    const int64 StartMs = MeleeNet::ToTimeMs(GetNetTime());
+    if (bUseFixedStepClock && bWasIdle)
+    {
+        PendingStartStep = MeleeNet::MsToStep(StartMs, FMath::Max(1, FixedStepHz));
+    }
+
+    // 로컬에서 먼저 반영해 보고, 실제로 반영된 입력만 서버로 보냄
+    const bool bApplied = HandleAttackInput(RequestedIndex, 0.f);
+    PendingStartStep = INDEX_NONE;
+    if (!bApplied) return;
+
+    // 콤보 끝(INDEX_NONE)이면 서버에 보낼 것이 없음
+    if (IsPredictingClient() && RequestedIndex != INDEX_NONE)
+    {
+        // (공격 인덱스, 시작 시각, 입력 순번)만 전송
+        FMeleeAttackNetRequest Request;
+        Request.AttackIndex = (uint8)FMath::Min(RequestedIndex, (1 << MeleeNet::AttackIndexBits) - 1);
+        Request.InputSeq = ++LocalInputSeq;
+        Request.StartTimeMs = (uint16)(StartMs & 0xFFFF);
+
+        if (bWasIdle)
+        {
+            AttackStartSeq = Request.InputSeq;
+        }
+        else if (!bWasBuffered)
+        {
+            BufferedInputSeq = Request.InputSeq;
+        }
+        ServerRequestAttack(Request);
+    }
+}
+
+void UMeeleAttackComponent::CancelAttack()
+{
+    bBufferedNext = false;
+    if (Phase == EAttackPhase::Idle) return;
+
+    SetPhase(EAttackPhase::Idle, GetWorldTime());
+    CurrentIndex = INDEX_NONE;
+}
+
+int32 UMeeleAttackComponent::GetComboContinuation() const
+{
+    if (Phase == EAttackPhase::Idle) return INDEX_NONE;
+    const int32 Next = GetNextIndex(CurrentIndex);
+    return GetSpec(Next) ? Next : INDEX_NONE;
+}
+
+void UMeeleAttackComponent::CarryCombo(int32 Index, float Window)
+{
+    if (!GetSpec(Index))
+    {
+        CarriedComboIndex = INDEX_NONE;
+        return;
+    }
+    CarriedComboIndex = Index;
+    CarriedComboExpire = GetWorldTime() + FMath::Max(0.f, Window);
+}
+
+int32 UMeeleAttackComponent::ResolveRequestedIndex() const
+{
+    if (Phase == EAttackPhase::Idle)
+    {
+        const bool bCarried = CarriedComboIndex != INDEX_NONE && GetWorldTime() <= CarriedComboExpire;
+        return bCarried ? CarriedComboIndex : DefaultAttackIndex;
+    }
+    return GetNextIndex(CurrentIndex);
+}
+
+bool UMeeleAttackComponent::HandleAttackInput(int32 RequestedIndex, float LatencyCompensation)
 {
     // 1) Idle이면 즉시 시작
     if (Phase == EAttackPhase::Idle)
     {
-        StartAttack(DefaultAttackIndex);
-        return;
+        if (RequestedIndex != DefaultAttackIndex && RequestedIndex != ResolveRequestedIndex()) return false;
+        // 서버: 클라이언트가 이미 진행한 만큼 시작 시각을 앞당김
+        StartAttack(RequestedIndex, GetWorldTime() - LatencyCompensation);
+        return Phase != EAttackPhase::Idle;
     }
 
     // 2) Active 구간의 "버퍼 오픈" 시점 이후면 다음 타 예약
@@ -43,7 +195,7 @@ void UMeeleAttackComponent::RequestAttack()
         if (Phase == EAttackPhase::Active)
         {
             // Active가 끝나기 직전 InputBufferOpen 만큼 남았으면 버퍼 허용
-            if ((S->ActiveTime - PhaseElapsed) <= FMath::Max(0.f, S->InputBufferOpen))
+            if ((GetPhaseDuration(CurrentIndex, EAttackPhase::Active) - GetPhaseElapsed()) <= FMath::Max(0.f, S->InputBufferOpen) + LatencyCompensation)
             {
                 bBufferedNext = true;
             }
@@ -54,109 +206,261 @@ void UMeeleAttackComponent::RequestAttack()
             bBufferedNext = true;
         }
     }
+    return bBufferedNext;
+}
+
+void UMeeleAttackComponent::ServerRequestAttack_Implementation(FMeleeAttackNetRequest Request)
+{
+    const float Now = GetNetTime();
+    const float ClientStart = MeleeNet::DequantizeTime(Request.StartTimeMs, Now);
+    const float Latency = FMath::Clamp(Now - ClientStart, 0.f, MaxLatencyCompensation);
+
+    if (bUseFixedStepClock && Phase == EAttackPhase::Idle)
+    {
+        // 클라이언트와 같은 정수 ms → 같은 시작 스텝 (보상 상한을 넘는 부분만 잘라냄)
+        const int64 NowMs = MeleeNet::ToTimeMs(Now);
+        const int64 StartMs = FMath::Clamp(MeleeNet::DequantizeTimeMs(Request.StartTimeMs, Now),
+            NowMs - (int64)FMath::FloorToInt(MaxLatencyCompensation * 1000.f), NowMs);
+        PendingStartStep = MeleeNet::MsToStep(StartMs, FMath::Max(1, FixedStepHz));
+    }
+
+    // 서버 상태 기준으로 해석한 인덱스와 다르면 예측 실패 → 클라이언트 롤백
+    const bool bApplied = Request.AttackIndex == ResolveRequestedIndex() && HandleAttackInput(Request.AttackIndex, Latency);
+    PendingStartStep = INDEX_NONE;
+    if (!bApplied)
+    {
+        ClientRejectAttack(Request.InputSeq);
+    }
+}
+
+void UMeeleAttackComponent::ClientRejectAttack_Implementation(uint8 InputSeq)
+{
+    // 예약만 거부된 경우: 다음 타 예약만 취소
+    if (bBufferedNext && InputSeq == BufferedInputSeq)
+    {
+        bBufferedNext = false;
+        return;
+    }
+
+    // 현재 공격을 시작시킨 입력이 거부된 경우에만 되돌림 (페이즈와 무관하게 Idle로)
+    if (InputSeq != AttackStartSeq || Phase == EAttackPhase::Idle) return;
+
+    bBufferedNext = false;
+    SetPhase(EAttackPhase::Idle, GetWorldTime());
+    CurrentIndex = INDEX_NONE;
+}
+
+void UMeeleAttackComponent::UpdateRepState()
+{
+    // 서버: 프록시용 압축 상태 갱신 (페이즈 전환 시에만 → 프레임 단위 복제 없음)
+    if (!GetOwner() || !GetOwner()->HasAuthority()) return;
+
+    RepState.AttackIndex = (uint8)FMath::Clamp(CurrentIndex, 0, (1 << MeleeNet::AttackIndexBits) - 1);
+    RepState.Phase = Phase;
+    RepState.PhaseStartMs = bUseFixedStepClock
+        ? (uint16)(MeleeNet::StepToMs(PhaseStartStep, FMath::Max(1, FixedStepHz)) & 0xFFFF)
+        : MeleeNet::QuantizeTime(GetNetTime() - GetPhaseElapsed());
+}
+
+void UMeeleAttackComponent::OnRep_AttackState()
+{
+    // 시뮬레이티드 프록시: 페이즈 전환만 받아 로컬 틱으로 진행
+    CurrentIndex = (RepState.Phase == EAttackPhase::Idle) ? INDEX_NONE : RepState.AttackIndex;
+    const float NetNow = GetNetTime();
+    const float Elapsed = FMath::Max(0.f, NetNow - MeleeNet::DequantizeTime(RepState.PhaseStartMs, NetNow));
+    if (bUseFixedStepClock)
+    {
+        PendingStartStep = MeleeNet::MsToStep(MeleeNet::DequantizeTimeMs(RepState.PhaseStartMs, NetNow), FMath::Max(1, FixedStepHz));
+    }
+    SetPhase(RepState.Phase, GetWorldTime() - Elapsed);
+    PendingStartStep = INDEX_NONE;
 }
 
-void UMeeleAttackComponent::StartAttack(int32 Index)
+void UMeeleAttackComponent::StartAttack(int32 Index, float StartTime)
 {
-    if (!AttackList.IsValidIndex(Index) || !Tracer) return;
+    if (!GetSpec(Index) || !Tracer) return;
 
     CurrentIndex = Index;
     bBufferedNext = false;
+    CarriedComboIndex = INDEX_NONE;
 
     ApplySpecToTracer(*CurSpec());
 
-    SetPhase(EAttackPhase::Warmup);
+    SetPhase(EAttackPhase::Warmup, StartTime);
 }
 
-void UMeeleAttackComponent::SetPhase(EAttackPhase NewPhase)
+void UMeeleAttackComponent::SetPhase(EAttackPhase NewPhase, float StartTime)
 {
+    const EAttackPhase PrevPhase = Phase;
     Phase = NewPhase;
-    PhaseElapsed = 0.f;
-
-    // 트레이서 토글
-    if (Phase == EAttackPhase::Active)
+    PhaseStartTime = StartTime;
+    if (bUseFixedStepClock)
     {
-        // Active 시작 시 창 열기
-        Tracer->StartTrace();
+        // 시작 스텝: 입력/복제 스탬프 > 경계 전환(현재 스텝) > 새로 시작(지금 스텝).
+        // 과거 스텝에서 시작하면 틱이 그 스텝부터 따라잡음 → 지연 보상도 정수 스텝 단위
+        if (PendingStartStep != INDEX_NONE) PhaseStartStep = PendingStartStep;
+        else if (PrevPhase == EAttackPhase::Idle) PhaseStartStep = GetNetStep();
+        else PhaseStartStep = SimStep;
+        PendingStartStep = INDEX_NONE;
+        if (PrevPhase == EAttackPhase::Idle) SimStep = PhaseStartStep;
+        SimStep = FMath::Max(SimStep, PhaseStartStep);
     }
-    else
+
+    // 트레이서 토글 (프록시는 트레이서 없이 복제될 수 있음).
+    // 시뮬레이티드 프록시는 페이즈/이벤트/FX만: 대미지는 서버 전용이라 스윕은 낭비
+    if (Tracer && CanRunTracer())
     {
-        // 그 외 구간/상태 전환 시 창 닫기(중복 안전)
-        Tracer->StopTrace(/*bClearHitCache=*/Phase == EAttackPhase::Idle);
+        if (Phase == EAttackPhase::Active)
+        {
+            // Active 시작 시 창 열기
+            Tracer->StartTrace();
+        }
+        else
+        {
+            // 그 외 구간/상태 전환 시 창 닫기(중복 안전)
+            Tracer->StopTrace(/*bClearHitCache=*/Phase == EAttackPhase::Idle);
+        }
     }
 
+    UpdateRepState();
+
     // 이벤트 브로드캐스트 (애님BP에서 이걸 받아 상태머신 전이/플립북 교체 등 처리)
     const FName AttackName = CurSpec() ? CurSpec()->Name : NAME_None;
+    COMBAT_TRACE_EVENT(TEXT("MeleePhase %s %s %s"), *GetNameSafe(GetOwner()), *AttackName.ToString(), *UEnum::GetValueAsString(Phase));
     OnPhaseChanged.Broadcast(Phase, AttackName);
+
+    UpdateTickState();
+    SchedulePhaseEnd();
 }
 
-const FMeleeAttackSpec* UMeeleAttackComponent::CurSpec() const
+float UMeeleAttackComponent::GetPhaseDuration(int32 Index, EAttackPhase InPhase) const
 {
-    return AttackList.IsValidIndex(CurrentIndex) ? &AttackList[CurrentIndex] : nullptr;
+    if (Timeline) return Timeline->GetPhaseDuration(Index, InPhase);
+
+    const FMeleeAttackSpec* Spec = GetSpec(Index);
+    if (!Spec) return 0.f;
+    switch (InPhase)
+    {
+    case EAttackPhase::Warmup:   return Spec->WarmupTime;
+    case EAttackPhase::Active:   return Spec->ActiveTime;
+    case EAttackPhase::Recovery: return Spec->RecoveryTime;
+    default: return 0.f;
+    }
 }
 
-void UMeeleAttackComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+int32 UMeeleAttackComponent::GetNextIndex(int32 Index) const
 {
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-    UpdatePhase(DeltaTime);
+    if (Timeline) return Timeline->GetNextIndex(Index);
+    const FMeleeAttackSpec* Spec = GetSpec(Index);
+    return Spec ? Spec->NextIndex : INDEX_NONE;
+}
+
+void UMeeleAttackComponent::SchedulePhaseEnd()
+{
+    // 경계 처리 루프 안에서는 루프가 끝난 뒤 한 번만 예약. 고정 스텝 모드는 틱에서 처리
+    if (bInPhaseAdvance || bUseFixedStepClock) return;
+
+    UWorld* World = GetWorld();
+    if (!World) return;
+
+    FTimerManager& TM = World->GetTimerManager();
+    TM.ClearTimer(PhaseTimer);
+
+    const FMeleeAttackSpec* S = CurSpec();
+    if (Phase == EAttackPhase::Idle || !S) return;
 
-    if (const FMeleeAttackSpec* S = CurSpec(); S && Tracer && S->RadiusScaleCurve && Phase == EAttackPhase::Active)
+    const float Remaining = GetPhaseDuration(CurrentIndex, Phase) - GetPhaseElapsed();
+    if (Remaining <= 0.f)
     {
-        const float t = GetNormProgress(); // 0~1 (Active 내부)
-        const float k = S->RadiusScaleCurve->GetFloatValue(FMath::Clamp(t, 0.f, 1.f));
-        Tracer->TraceConfig.Radius = FMath::Max(1.f, S->BaseTraceRadius * (k <= 0.f ? 1.f : k));
+        // 이미 지난 경계(0초 페이즈/지연 보상)는 즉시 처리
+        OnPhaseTimer();
+        return;
     }
+    TM.SetTimer(PhaseTimer, this, &UMeeleAttackComponent::OnPhaseTimer, Remaining, false);
 }
 
-float UMeeleAttackComponent::GetNormProgress() const
+void UMeeleAttackComponent::OnPhaseTimer()
 {
-    if (const FMeleeAttackSpec* S = CurSpec())
+    COMBAT_SCOPE(STAT_CombatMeleeUpdatePhase);
     {
-        switch (Phase)
+        TGuardValue<bool> Guard(bInPhaseAdvance, true);
+
+        // 프레임이 길어 여러 경계를 지났으면 모두 처리. 다음 페이즈는 경계 시각에서 시작 → 드리프트 없음
+        const float Now = GetWorldTime();
+        for (int32 Safety = 0; Safety < 16 && Phase != EAttackPhase::Idle; ++Safety)
         {
-        case EAttackPhase::Warmup:  return S->WarmupTime > 0 ? (PhaseElapsed / S->WarmupTime) : 1.f;
-        case EAttackPhase::Active:  return S->ActiveTime > 0 ? (PhaseElapsed / S->ActiveTime) : 1.f;
-        case EAttackPhase::Recovery:return S->RecoveryTime > 0 ? (PhaseElapsed / S->RecoveryTime) : 1.f;
-        default: break;
+            const FMeleeAttackSpec* S = CurSpec();
+            const float Boundary = S ? PhaseStartTime + GetPhaseDuration(CurrentIndex, Phase) : Now;
+            if (S && Now < Boundary) break;
+            AdvancePhase(FMath::Min(Boundary, Now));
         }
     }
-    return 0.f;
+    SchedulePhaseEnd();
 }
 
-void UMeeleAttackComponent::UpdatePhase(float DeltaTime)
+void UMeeleAttackComponent::UpdateTickState()
 {
-    if (Phase == EAttackPhase::Idle) return;
+    bool bNeedsTick = false;
+    if (bUseFixedStepClock)
+    {
+        bNeedsTick = (Phase != EAttackPhase::Idle);
+    }
+    else if (Phase == EAttackPhase::Active && Tracer && CanRunTracer())
+    {
+        if (Timeline) bNeedsTick = Timeline->HasRadiusCurve(CurrentIndex);
+        else if (const FMeleeAttackSpec* S = CurSpec()) bNeedsTick = (S->RadiusScaleCurve != nullptr);
+    }
+    SetComponentTickEnabled(bNeedsTick);
+}
 
-    PhaseElapsed += DeltaTime;
+const FMeleeAttackSpec* UMeeleAttackComponent::GetSpec(int32 Index) const
+{
+    if (Timeline) return Timeline->GetSpec(Index);
+    return AttackList.IsValidIndex(Index) ? &AttackList[Index] : nullptr;
+}
+
+const FMeleeAttackSpec* UMeeleAttackComponent::CurSpec() const
+{
+    return GetSpec(CurrentIndex);
+}
 
+float UMeeleAttackComponent::GetNormProgress() const
+{
+    if (const FMeleeAttackSpec* S = CurSpec())
+    {
+        const float Duration = GetPhaseDuration(CurrentIndex, Phase);
+        if (Phase == EAttackPhase::Idle) return 0.f;
+        return Duration > 0.f ? (GetPhaseElapsed() / Duration) : 1.f;
+    }
+    return 0.f;
+}
+
+void UMeeleAttackComponent::AdvancePhase(float BoundaryTime)
+{
     const FMeleeAttackSpec* S = CurSpec();
-    if (!S) { SetPhase(EAttackPhase::Idle); return; }
+    if (!S) { SetPhase(EAttackPhase::Idle, BoundaryTime); return; }
 
     switch (Phase)
     {
     case EAttackPhase::Warmup:
-        if (PhaseElapsed >= S->WarmupTime)
-            SetPhase(EAttackPhase::Active);
+        SetPhase(EAttackPhase::Active, BoundaryTime);
         break;
 
     case EAttackPhase::Active:
-        if (PhaseElapsed >= S->ActiveTime)
-            SetPhase(EAttackPhase::Recovery);
+        SetPhase(EAttackPhase::Recovery, BoundaryTime);
         break;
 
     case EAttackPhase::Recovery:
-        if (PhaseElapsed >= S->RecoveryTime)
+        // 콤보 큐가 있으면 다음 타로 이어가기
+        if (const int32 Next = GetNextIndex(CurrentIndex); bBufferedNext && Next != INDEX_NONE)
         {
-            // 콤보 큐가 있으면 다음 타로 이어가기
-            if (bBufferedNext && S->NextIndex != INDEX_NONE)
-            {
-                StartAttack(S->NextIndex);
-            }
-            else
-            {
-                SetPhase(EAttackPhase::Idle);
-                CurrentIndex = INDEX_NONE;
-            }
+            AttackStartSeq = BufferedInputSeq;
+            StartAttack(Next, BoundaryTime);
+        }
+        else
+        {
+            SetPhase(EAttackPhase::Idle, BoundaryTime);
+            CurrentIndex = INDEX_NONE;
         }
         break;
 
@@ -170,6 +474,7 @@ void UMeeleAttackComponent::ApplySpecToTracer(const FMeleeAttackSpec& Spec)
 
     // 트레이서의 스윕 세부 옵션 동기화
     Tracer->TraceConfig.Radius = Spec.BaseTraceRadius;
+    Tracer->TraceConfig.SamplesAlongBlade = Spec.SamplesAlongBlade;
     Tracer->TraceConfig.MaxStepDistance = Spec.MaxStepDistance;
     Tracer->TraceConfig.ExtraSubdivisions = Spec.ExtraSubdivisions;
 
@@ -182,3 +487,71 @@ void UMeeleAttackComponent::OnTracerHit(const FHitResult& Hit)
     // VFX/SFX/카메라 셰이크 브로드캐스트
     OnHit.Broadcast(Hit);
 }
+
+void UMeeleAttackComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    if (bUseFixedStepClock)
+    {
+        TickFixedSteps();
+        return;
+    }
+    UpdateRadiusFromCurve();
+}
+
+void UMeeleAttackComponent::TickFixedSteps()
+{
+    COMBAT_SCOPE(STAT_CombatMeleeUpdatePhase);
+
+    // 공유 클럭의 현재 스텝까지 정수 스텝으로 진행 (따라잡기 상한 초과분은 다음 프레임으로)
+    const int32 NumSteps = (int32)FMath::Clamp<int64>(GetNetStep() - SimStep, 0, MaxCatchUpSteps);
+
+    for (int32 Step = 0; Step < NumSteps && Phase != EAttackPhase::Idle; ++Step)
+    {
+        ++SimStep;
+
+        // 이 스텝에서 지난 경계를 모두 처리 (0스텝 페이즈 포함). 다음 페이즈는 경계 스텝에서 시작 → 긴 프레임에도 Active 구간을 건너뛰지 않음
+        for (int32 Safety = 0; Safety < 16 && Phase != EAttackPhase::Idle; ++Safety)
+        {
+            const FMeleeAttackSpec* S = CurSpec();
+            const int64 BoundaryStep = PhaseStartStep + (S ? ToSteps(GetPhaseDuration(CurrentIndex, Phase)) : 0);
+            if (S && SimStep < BoundaryStep) break;
+            PendingStartStep = BoundaryStep;
+            AdvancePhase(GetWorldTime());
+            PendingStartStep = INDEX_NONE;
+        }
+
+        if (Phase == EAttackPhase::Active && Tracer && CanRunTracer())
+        {
+            UpdateRadiusFromCurve();
+            Tracer->StepTrace((float)(Step + 1) / (float)NumSteps);
+        }
+    }
+}
+
+void UMeeleAttackComponent::UpdateRadiusFromCurve()
+{
+    if (const FMeleeAttackSpec* S = CurSpec(); S && Tracer && Phase == EAttackPhase::Active)
+    {
+        const float t = FMath::Clamp(GetNormProgress(), 0.f, 1.f); // 0~1 (Active 내부)
+        float k = 1.f;
+        bool bHasCurve = false;
+        if (Timeline)
+        {
+            // 베이크된 샘플 (커브 평가 없음)
+            bHasCurve = Timeline->SampleRadiusScale(CurrentIndex, t, k);
+        }
+        else if (S->RadiusScaleCurve)
+        {
+            k = S->RadiusScaleCurve->GetFloatValue(t);
+            bHasCurve = true;
+        }
+
+        if (bHasCurve)
+        {
+            Tracer->TraceConfig.Radius = FMath::Max(1.f, S->BaseTraceRadius * (k <= 0.f ? 1.f : k));
+        }
+    }
+}
+
@@ -6,6 +6,7 @@
 #include "Components/ActorComponent.h"
 #include "MeleeHitTracerComponent.h"   // 앞서 만든 본 스윕 트레이서
 #include "Curves/CurveFloat.h"
+#include "CombatNet.h"
 #include "DRAttackComponent.generated.h"
 
 
@@ -58,9 +59,77 @@ struct FMeleeAttackSpec {
     float InputBufferOpen = 0.08f; // Active 끝 - N초 전부터 입력을 버퍼링
 };
 
+namespace MeleeNet
+{
+    using CombatNet::QuantizeTime;
+    using CombatNet::DequantizeTime;
+
+    constexpr int32 AttackIndexBits = 6; // 공격 스펙 최대 64개
+
+    // 고정 스텝 공유 클럭: 서버 월드 시각의 정수 ms → 스텝 인덱스 (양쪽이 같은 16비트 스탬프에서 같은 스텝을 얻음)
+    inline int64 ToTimeMs(float Seconds) { return FMath::FloorToInt64(Seconds * 1000.0); }
+    inline int64 DequantizeTimeMs(uint16 Quantized, float Now)
+    {
+        const int64 NowMs = ToTimeMs(Now);
+        return NowMs - (uint16)((uint16)(NowMs & 0xFFFF) - Quantized);
+    }
+    inline int64 MsToStep(int64 Ms, int32 Hz) { return Ms * Hz / 1000; }
+    inline int64 StepToMs(int64 Step, int32 Hz) { return (Step * 1000 + Hz - 1) / Hz; } // MsToStep의 역 (올림)
+}
+
+// 클라이언트 → 서버 공격 입력 (30비트)
+USTRUCT()
+struct FMeleeAttackNetRequest
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    uint8 AttackIndex = 0;
+
+    UPROPERTY()
+    uint8 InputSeq = 0;
+
+    UPROPERTY()
+    uint16 StartTimeMs = 0;
+
+    bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FMeleeAttackNetRequest> : public TStructOpsTypeTraitsBase2<FMeleeAttackNetRequest>
+{
+    enum { WithNetSerializer = true };
+};
+
+// 시뮬레이티드 프록시용 압축 페이즈 상태 (24비트, 페이즈 전환 시에만 변경)
+USTRUCT()
+struct FMeleeAttackRepState
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    uint8 AttackIndex = 0;
+
+    UPROPERTY()
+    EAttackPhase Phase = EAttackPhase::Idle;
+
+    UPROPERTY()
+    uint16 PhaseStartMs = 0;
+
+    bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FMeleeAttackRepState> : public TStructOpsTypeTraitsBase2<FMeleeAttackRepState>
+{
+    enum { WithNetSerializer = true };
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAttackPhaseChanged, EAttackPhase, Phase, FName, AttackName);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAttackHit, const FHitResult&, Hit);
 
+class UMeleeAttackTimeline;
+
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class PROJECT_NAME_API UMeeleAttackComponent : public UActorComponent
 {
@@ -78,6 +147,10 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee")
     TArray<FMeleeAttackSpec> AttackList;
 
+    // 공유 타임라인 에셋. 설정 시 AttackList 대신 사용 (인스턴스별 복사 없음)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee")
+    UMeleeAttackTimeline* Timeline = nullptr;
+
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee")
     int32 DefaultAttackIndex = 0;
@@ -86,6 +159,21 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee")
     bool bServerAuthoritative = true;
 
+    // 서버가 클라이언트 입력 지연만큼 페이즈를 앞당겨 주는 최대 시간(초)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Networking", meta = (ClampMin = "0.0"))
+    float MaxLatencyCompensation = 0.2f;
+
+    // 고정 스텝 전투 클럭: 페이즈를 정수 스텝으로 진행하고 스텝마다 트레이서 실행 (리플레이/서버-클라 일치용)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Simulation")
+    bool bUseFixedStepClock = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Simulation", meta = (EditCondition = "bUseFixedStepClock", ClampMin = "10", ClampMax = "240"))
+    int32 FixedStepHz = 60;
+
+    // 한 프레임에 따라잡을 최대 스텝 수 (초과분은 다음 프레임으로 이월, 버리지 않음)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Simulation", meta = (EditCondition = "bUseFixedStepClock", ClampMin = "1"))
+    int32 MaxCatchUpSteps = 8;
+
     // 입력 처리 API
     UFUNCTION(BlueprintCallable, Category = "Melee")
     void RequestAttack();              // 사용자 입력 (버퍼링 포함)
@@ -93,6 +181,17 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Melee")
     bool IsBusy() const { return Phase != EAttackPhase::Idle; }
 
+    // 진행 중 공격을 즉시 Idle로 (스왑 아웃/휴면 진입). 트레이서 창 닫고 페이즈 타이머/틱 정지
+    UFUNCTION(BlueprintCallable, Category = "Melee")
+    void CancelAttack();
+
+    // 스왑 콤보 인계: 진행 중 공격에서 이어질 다음 타 인덱스 (콤보 끝/Idle이면 INDEX_NONE)
+    int32 GetComboContinuation() const;
+
+    // Window초 안의 다음 Idle 입력을 Index 타부터 시작 (스왑으로 들어온 캐릭터가 콤보를 이어받을 때)
+    UFUNCTION(BlueprintCallable, Category = "Melee")
+    void CarryCombo(int32 Index, float Window);
+
     // 이벤트(애님BP/이펙트 연동용)
     UPROPERTY(BlueprintAssignable, Category = "Melee")
     FOnAttackPhaseChanged OnPhaseChanged;
@@ -103,9 +202,11 @@ public:
 protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 public:	
-	// Called every frame
+	// Active 구간에 반경 커브가 있을 때만 틱 (그 외 페이즈 전환은 타이머 구동)
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 		
@@ -114,16 +215,73 @@ private:
     // 진행 상태
     EAttackPhase Phase = EAttackPhase::Idle;
     int32 CurrentIndex = INDEX_NONE;
-    float PhaseElapsed = 0.f;
+    float PhaseStartTime = 0.f; // 월드 시간 기준 현재 페이즈 시작 (경계 시각, 초과분 누적 없음)
+
+    FTimerHandle PhaseTimer;
+    bool bInPhaseAdvance = false;
+
+    // 고정 스텝 모드 상태: 서버 월드 시각 기준 공유 스텝 인덱스 (피어별 DeltaTime 누적 없음)
+    int64 SimStep = 0;                    // 마지막으로 처리한 스텝
+    int64 PhaseStartStep = 0;             // 현재 페이즈 시작 스텝
+    int64 PendingStartStep = INDEX_NONE;  // 입력/복제로 받은 다음 SetPhase의 시작 스텝
 
     bool bBufferedNext = false; // 입력 버퍼 플래그
 
-    // 내부 흐름
-    void StartAttack(int32 Index);
-    void SetPhase(EAttackPhase NewPhase);
-    void UpdatePhase(float DeltaTime);
+    // CarryCombo로 받은 시작 인덱스와 만료 시각
+    int32 CarriedComboIndex = INDEX_NONE;
+    float CarriedComboExpire = 0.f;
+
+    // 네트워크: 소유 클라이언트는 예측 실행 후 입력만 서버로 전송
+    uint8 LocalInputSeq = 0;
+    uint8 AttackStartSeq = 0;   // 현재 공격을 시작시킨 입력 순번 (거부 시 롤백 기준)
+    uint8 BufferedInputSeq = 0; // 다음 타를 예약한 입력 순번
+
+    UPROPERTY(ReplicatedUsing = OnRep_AttackState)
+    FMeleeAttackRepState RepState;
+
+    UFUNCTION()
+    void OnRep_AttackState();
 
-    // 현재 스펙 헬퍼
+    UFUNCTION(Server, Reliable)
+    void ServerRequestAttack(FMeleeAttackNetRequest Request);
+
+    UFUNCTION(Client, Reliable)
+    void ClientRejectAttack(uint8 InputSeq);
+
+    void UpdateRepState();
+    bool IsPredictingClient() const;
+    // 서버/소유 클라이언트만 블레이드 스윕 (시뮬레이티드 프록시는 페이즈 진행만)
+    bool CanRunTracer() const;
+    float GetNetTime() const;
+
+    // 입력 처리 공통 (로컬/서버). 반영되지 않으면 false
+    bool HandleAttackInput(int32 RequestedIndex, float LatencyCompensation);
+    int32 ResolveRequestedIndex() const;
+
+    // 내부 흐름
+    void StartAttack(int32 Index, float StartTime);
+    void SetPhase(EAttackPhase NewPhase, float StartTime);
+    void AdvancePhase(float BoundaryTime);
+
+    // 페이즈 스케줄링: 다음 경계에 타이머 1개, 지난 경계는 한 번에 처리
+    void SchedulePhaseEnd();
+    void OnPhaseTimer();
+    void UpdateTickState();
+
+    float GetWorldTime() const;
+    float GetPhaseElapsed() const;
+    float GetPhaseDuration(int32 Index, EAttackPhase InPhase) const; // Timeline이면 베이크 테이블
+    int32 GetNextIndex(int32 Index) const;
+
+    // 고정 스텝 진행
+    float GetStepSeconds() const { return 1.f / (float)FMath::Max(1, FixedStepHz); }
+    int32 ToSteps(float Seconds) const { return FMath::RoundToInt(Seconds * FMath::Max(1, FixedStepHz)); }
+    int64 GetNetStep() const { return MeleeNet::MsToStep(MeleeNet::ToTimeMs(GetNetTime()), FMath::Max(1, FixedStepHz)); }
+    void TickFixedSteps();
+    void UpdateRadiusFromCurve();
+
+    // 현재 스펙 헬퍼 (Timeline 우선, 없으면 AttackList)
+    const FMeleeAttackSpec* GetSpec(int32 Index) const;
     const FMeleeAttackSpec* CurSpec() const;
     float GetNormProgress() const; // 0~1, Warmup/Active/Recovery 구간별 상대 시간
 
@@ -2,26 +2,100 @@
 
 
 #include "MeleeHitTracerComponent.h"
+#include "MeleeTraceSubsystem.h"
+#include "CombatStats.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Components/PrimitiveComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "DrawDebugHelpers.h"
 #include "GameFramework/Actor.h"
 #include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
 
+namespace MeleeTrace
+{
+    // 피벗 기준 방향은 slerp, 거리는 lerp → 호를 따라 이동하는 점
+    static FVector ArcLerp(const FVector& Pivot0, const FVector& Pivot1, const FVector& P0, const FVector& P1, float T)
+    {
+        const FVector D0 = P0 - Pivot0;
+        const FVector D1 = P1 - Pivot1;
+        const FQuat Delta = FQuat::FindBetweenVectors(D0, D1);
+        const FVector Dir = FQuat::Slerp(FQuat::Identity, Delta, T).RotateVector(D0.GetSafeNormal());
+        return FMath::Lerp(Pivot0, Pivot1, T) + Dir * FMath::Lerp(D0.Size(), D1.Size(), T);
+    }
+
+    static float AngleDegrees(const FVector& A, const FVector& B)
+    {
+        const float Cos = FVector::DotProduct(A.GetSafeNormal(), B.GetSafeNormal());
+        return FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp(Cos, -1.f, 1.f)));
+    }
+}
 
 UMeleeHitTracerComponent::UMeleeHitTracerComponent()
 {
-    PrimaryComponentTick.bCanEverTick = true;
-    SetComponentTickEnabled(false); // StartTrace()에서만 틱 활성화
+    // 컴포넌트 틱 없음: 활성 창 동안 UMeleeTraceSubsystem이 구동
+    PrimaryComponentTick.bCanEverTick = false;
+    // 복제 프로퍼티 없음. 히트 주장 RPC(ServerClaimHit)용
+    SetIsReplicatedByDefault(true);
 }
 
 void UMeleeHitTracerComponent::BeginPlay()
 {
     Super::BeginPlay();
+
+    // 네트워크 서버: 주장된 히트의 리치를 과거 위치로 검증하기 위해 공격자 포즈도 기록
+    AActor* Owner = GetOwner();
+    UWorld* World = GetWorld();
+    if (Owner && World && Owner->HasAuthority() && World->GetNetMode() != NM_Standalone)
+    {
+        if (UMeleeTraceSubsystem* Sub = World->GetSubsystem<UMeleeTraceSubsystem>())
+        {
+            Sub->RegisterRewindTarget(Owner);
+        }
+    }
+}
+
+void UMeleeHitTracerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    StopTrace();
+    if (UWorld* World = GetWorld())
+    {
+        if (UMeleeTraceSubsystem* Sub = World->GetSubsystem<UMeleeTraceSubsystem>())
+        {
+            Sub->UnregisterRewindTarget(GetOwner());
+        }
+    }
+    Super::EndPlay(EndPlayReason);
+}
+
+UMeleeHitTracerComponent::FTraceWindowSpan* UMeleeHitTracerComponent::FindWindowSpan(float Time)
+{
+    // 최신 창부터: 슬랙이 겹치는 경계에서는 나중 창으로 판정
+    for (int32 i = 0; i < NumWindowSpans; ++i)
+    {
+        FTraceWindowSpan& Span = WindowSpans[(WindowSpanHead - i + NumWindowSpans) % NumWindowSpans];
+        if (Time >= Span.Start - ClaimWindowSlack && Time <= Span.End + ClaimWindowSlack) return &Span;
+    }
+    return nullptr;
+}
+
+FMeleeHitCache& UMeleeHitTracerComponent::GetHitCacheForCurrentTime()
+{
+    if (GetOwner() && GetOwner()->HasAuthority())
+    {
+        if (FTraceWindowSpan* Span = FindWindowSpan(CurrentHitTime))
+        {
+            return Span->Hits;
+        }
+    }
+    return AlreadyHit;
 }
 
 void UMeleeHitTracerComponent::StartTrace()
 {
+    // 이전 창이 열려 있었으면 구간을 닫고 새 창으로
+    StopTrace(/*bClearHitCache*/ false);
+
     if (!WeaponMesh)
     {
         // 자동 추론: 소유 액터의 첫 번째 SkeletalMesh 사용 시도
@@ -38,24 +112,56 @@ void UMeleeHitTracerComponent::StartTrace()
 
     bActive = (WeaponMesh != nullptr);
     bHasPrev = false; // 첫 프레임은 시드만
+    ++TraceWindowId;
+    if (bActive)
+    {
+        BuildQueryParams(CachedQueryParams);
+        if (GetOwner() && GetOwner()->HasAuthority() && GetWorld())
+        {
+            WindowSpanHead = (WindowSpanHead + 1) % NumWindowSpans;
+            FTraceWindowSpan& Span = WindowSpans[WindowSpanHead];
+            Span.WindowId = TraceWindowId;
+            Span.Start = GetWorld()->GetTimeSeconds();
+            Span.End = FLT_MAX;
+            Span.Hits.Reset();
+        }
+    }
     if (bHitEachActorOncePerWindow) AlreadyHit.Reset();
-    SetComponentTickEnabled(bActive);
+
+    if (UWorld* World = GetWorld())
+    {
+        if (UMeleeTraceSubsystem* Sub = World->GetSubsystem<UMeleeTraceSubsystem>())
+        {
+            if (bActive) Sub->RegisterTracer(this);
+            else Sub->UnregisterTracer(this);
+        }
+    }
 }
 
 void UMeleeHitTracerComponent::StopTrace(bool bClearHitCache)
 {
+    if (bActive)
+    {
+        if (UWorld* World = GetWorld())
+        {
+            if (UMeleeTraceSubsystem* Sub = World->GetSubsystem<UMeleeTraceSubsystem>())
+            {
+                Sub->UnregisterTracer(this);
+            }
+            if (WindowSpans[WindowSpanHead].End == FLT_MAX)
+            {
+                WindowSpans[WindowSpanHead].End = World->GetTimeSeconds();
+            }
+        }
+    }
+
     bActive = false;
-    SetComponentTickEnabled(false);
     bHasPrev = false;
-    if (bClearHitCache) AlreadyHit.Reset();
-}
-
-void UMeleeHitTracerComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
-{
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-    if (bActive)
+    if (bClearHitCache)
     {
-        DoFrameSweep();
+        // 창 취소: 아직 돌아오지 않은 비동기 결과도 무효
+        ++TraceWindowId;
+        AlreadyHit.Reset();
     }
 }
 
@@ -94,107 +200,268 @@ bool UMeleeHitTracerComponent::GetCurrentBladePoints(FVector& OutRoot, FVector&
     return true;
 }
 
-void UMeleeHitTracerComponent::DoFrameSweep()
+FVector UMeleeHitTracerComponent::GetCurrentPivot() const
+{
+    if (WeaponMesh && TraceConfig.ArcPivotSocketName != NAME_None && WeaponMesh->DoesSocketExist(TraceConfig.ArcPivotSocketName))
+    {
+        return WeaponMesh->GetSocketLocation(TraceConfig.ArcPivotSocketName);
+    }
+    const AActor* Owner = GetOwner();
+    return Owner ? Owner->GetActorLocation() : FVector::ZeroVector;
+}
+
+void UMeleeHitTracerComponent::GatherFrameSweeps(FMeleeSweepBatch& Out)
 {
+    COMBAT_SCOPE(STAT_CombatMeleeGather);
     FVector CurrRoot, CurrTip;
     if (!GetCurrentBladePoints(CurrRoot, CurrTip)) return;
 
+    const bool bArc = (TraceConfig.Interpolation == EMeleeTraceInterp::Arc);
+    const FVector CurrPivot = bArc ? GetCurrentPivot() : FVector::ZeroVector;
+    GatherSweepsToPose(Out, CurrRoot, CurrTip, CurrPivot);
+}
+
+void UMeleeHitTracerComponent::StepTrace(float FrameAlpha)
+{
+    if (!bActive) return;
+
+    UWorld* World = GetWorld();
+    UMeleeTraceSubsystem* Sub = World ? World->GetSubsystem<UMeleeTraceSubsystem>() : nullptr;
+    FVector SockRoot, SockTip;
+    if (!Sub || !GetCurrentBladePoints(SockRoot, SockTip)) return;
+
+    const bool bArc = (TraceConfig.Interpolation == EMeleeTraceInterp::Arc);
+    const FVector SockPivot = bArc ? GetCurrentPivot() : FVector::ZeroVector;
+
+    // 프레임 첫 스텝에서 시작 포즈 고정 → 이후 스텝은 시작~현재 소켓 사이를 FrameAlpha로 보간
+    if (StepFrameNumber != GFrameCounter)
+    {
+        StepFrameNumber = GFrameCounter;
+        FrameStartRoot = bHasPrev ? PrevRoot : SockRoot;
+        FrameStartTip = bHasPrev ? PrevTip : SockTip;
+        FrameStartPivot = bHasPrev ? PrevPivot : SockPivot;
+    }
+
+    const float Alpha = FMath::Clamp(FrameAlpha, 0.f, 1.f);
+    const FVector Root = FMath::Lerp(FrameStartRoot, SockRoot, Alpha);
+    const FVector Tip = FMath::Lerp(FrameStartTip, SockTip, Alpha);
+    const FVector Pivot = FMath::Lerp(FrameStartPivot, SockPivot, Alpha);
+
+    // 창이 한 스텝만 열려도 판정되도록 첫 스텝은 제자리 스윕
+    if (!bHasPrev)
+    {
+        PrevRoot = Root;
+        PrevTip = Tip;
+        PrevPivot = Pivot;
+        bHasPrev = true;
+    }
+
+    StepBatch.Reset();
+    StepBatch.BeginTracer(0);
+    GatherSweepsToPose(StepBatch, Root, Tip, Pivot);
+    Sub->ExecuteImmediate(this, StepBatch);
+}
+
+void UMeleeHitTracerComponent::GatherSweepsToPose(FMeleeSweepBatch& Out, const FVector& CurrRoot, const FVector& CurrTip, const FVector& CurrPivot)
+{
+    const bool bArc = (TraceConfig.Interpolation == EMeleeTraceInterp::Arc);
+
     if (!bHasPrev)
     {
         PrevRoot = CurrRoot;
         PrevTip = CurrTip;
+        PrevPivot = CurrPivot;
         bHasPrev = true;
         return; // 다음 프레임부터 실제 스윕
     }
 
-    const int32 SamplesAlongBlade = 3; // 루트/중간/팁 3지점
-    for (int32 i = 0; i < SamplesAlongBlade; ++i)
+    if (bArc)
+    {
+        // 팁의 회전각 기준으로 서브프레임 포즈를 만들어 호를 여러 현으로 근사
+        const float Angle = MeleeTrace::AngleDegrees(PrevTip - PrevPivot, CurrTip - CurrPivot);
+        const int32 SubFrames = FMath::Clamp(FMath::CeilToInt(Angle / FMath::Max(1.f, TraceConfig.MaxArcStepDegrees)), 1, FMath::Max(1, TraceConfig.MaxArcSubframes));
+
+        FVector R0 = PrevRoot, Tip0 = PrevTip;
+        for (int32 k = 1; k <= SubFrames; ++k)
+        {
+            const float Alpha = (float)k / (float)SubFrames;
+            const FVector R1 = (k == SubFrames) ? CurrRoot : MeleeTrace::ArcLerp(PrevPivot, CurrPivot, PrevRoot, CurrRoot, Alpha);
+            const FVector Tip1 = (k == SubFrames) ? CurrTip : MeleeTrace::ArcLerp(PrevPivot, CurrPivot, PrevTip, CurrTip, Alpha);
+            SweepBladePose(Out, R0, Tip0, R1, Tip1);
+            R0 = R1;
+            Tip0 = Tip1;
+        }
+    }
+    else
     {
-        const float T = (SamplesAlongBlade == 1) ? 0.f : (float)i / (SamplesAlongBlade - 1);
-        const FVector PrevPoint = FMath::Lerp(PrevRoot, PrevTip, T);
-        const FVector CurrPoint = FMath::Lerp(CurrRoot, CurrTip, T);
-        SweepSegment(PrevPoint, CurrPoint);
+        SweepBladePose(Out, PrevRoot, PrevTip, CurrRoot, CurrTip);
     }
 
     PrevRoot = CurrRoot;
     PrevTip = CurrTip;
+    PrevPivot = CurrPivot;
 }
 
-void UMeleeHitTracerComponent::SweepSegment(const FVector& Start, const FVector& End)
+void UMeleeHitTracerComponent::SweepBladePose(FMeleeSweepBatch& Out, const FVector& Root0, const FVector& Tip0, const FVector& Root1, const FVector& Tip1)
 {
-    UWorld* World = GetWorld();
-    if (!World) return;
+    if (TraceConfig.Shape == EMeleeTraceShape::Capsule)
+    {
+        // 루트~팁을 잇는 캡슐 하나로 스윕: 스텝당 쿼리 1회, 샘플 사이 틈 없음
+        SweepBladeVolume(Out, Root0, Tip0, Root1, Tip1);
+    }
+    else
+    {
+        const FQuat Rot0 = FRotationMatrix::MakeFromX(Tip0 - Root0).ToQuat();
+        const FQuat Rot1 = FRotationMatrix::MakeFromX(Tip1 - Root1).ToQuat();
 
-    const float Dist = FVector::Distance(Start, End);
+        const int32 SamplesAlongBlade = FMath::Max(1, TraceConfig.SamplesAlongBlade);
+        for (int32 i = 0; i < SamplesAlongBlade; ++i)
+        {
+            const float T = (SamplesAlongBlade == 1) ? 0.f : (float)i / (SamplesAlongBlade - 1);
+            const FVector P0 = FMath::Lerp(Root0, Tip0, T);
+            const FVector P1 = FMath::Lerp(Root1, Tip1, T);
+            SweepSegment(Out, P0, P1, Rot0, Rot1);
+        }
+    }
+}
+
+int32 UMeleeHitTracerComponent::ComputeStepCount(float Dist) const
+{
     const int32 StepsByDistance = FMath::Max(1, FMath::CeilToInt(Dist / FMath::Max(1.f, TraceConfig.MaxStepDistance)));
-    const int32 TotalSteps = FMath::Max(1, StepsByDistance * FMath::Max(1, TraceConfig.ExtraSubdivisions));
+    return FMath::Max(1, StepsByDistance * FMath::Max(1, TraceConfig.ExtraSubdivisions));
+}
+
+void UMeleeHitTracerComponent::SweepSegment(FMeleeSweepBatch& Out, const FVector& Start, const FVector& End, const FQuat& StartRot, const FQuat& EndRot)
+{
+    COMBAT_SCOPE(STAT_CombatMeleeSweepSegment);
+    const int32 TotalSteps = ComputeStepCount(FVector::Distance(Start, End));
+    const FCollisionShape Shape = MakeSweepShape(0.f);
 
+    // 여기서는 서브스텝만 적재하고 실제 쿼리는 UMeleeTraceSubsystem에서 일괄 처리
     for (int32 s = 0; s < TotalSteps; ++s)
     {
         const float T0 = (float)s / (float)TotalSteps;
         const float T1 = (float)(s + 1) / (float)TotalSteps;
 
-        const FVector A = FMath::Lerp(Start, End, T0);
-        const FVector B = FMath::Lerp(Start, End, T1);
-        const FVector Dir = (B - A);
-        const FQuat Rot = FQuat::Identity;
+        Out.Add(FMath::Lerp(Start, End, T0), FMath::Lerp(Start, End, T1),
+            FQuat::Slerp(StartRot, EndRot, 0.5f * (T0 + T1)), Shape);
+    }
+}
 
-        FCollisionQueryParams QP;
-        BuildQueryParams(QP);
+void UMeleeHitTracerComponent::SweepBladeVolume(FMeleeSweepBatch& Out, const FVector& Root0, const FVector& Tip0, const FVector& Root1, const FVector& Tip1)
+{
+    COMBAT_SCOPE(STAT_CombatMeleeSweepSegment);
+    // 팁이 가장 많이 움직이므로 루트/팁 중 큰 이동량 기준으로 분할
+    const float Dist = FMath::Max(FVector::Distance(Root0, Root1), FVector::Distance(Tip0, Tip1));
+    const int32 TotalSteps = ComputeStepCount(Dist);
 
-        if (TraceConfig.Shape == EMeleeTraceShape::Sphere)
-        {
-            TArray<FHitResult> Hits;
-            const bool bHit = World->SweepMultiByChannel(
-                Hits, A, B, Rot, TraceConfig.TraceChannel,
-                FCollisionShape::MakeSphere(TraceConfig.Radius), QP);
+    for (int32 s = 0; s < TotalSteps; ++s)
+    {
+        const float T0 = (float)s / (float)TotalSteps;
+        const float T1 = (float)(s + 1) / (float)TotalSteps;
+        const float TMid = 0.5f * (T0 + T1);
 
-            if (TraceConfig.bDebugDraw)
-            {
-                DrawDebugBetween(A, B, bHit ? FColor::Red : FColor::Green, TraceConfig.DebugLifeTime);
-                DrawDebugSphere(World, B, TraceConfig.Radius, 12, bHit ? FColor::Red : FColor::Green, false, TraceConfig.DebugLifeTime);
-            }
+        const FVector RootMid = FMath::Lerp(Root0, Root1, TMid);
+        const FVector TipMid = FMath::Lerp(Tip0, Tip1, TMid);
+        const FVector Axis = TipMid - RootMid;
 
-            if (bHit)
-            {
-                for (const FHitResult& H : Hits)
-                {
-                    HandleHit(H, Dir.GetSafeNormal());
-                }
-            }
-        }
-        else // Box
-        {
-            TArray<FHitResult> Hits;
-            const bool bHit = World->SweepMultiByChannel(
-                Hits, A, B, Rot, TraceConfig.TraceChannel,
-                FCollisionShape::MakeBox(TraceConfig.BoxHalfExtents), QP);
+        // 언리얼 캡슐은 Z축 기준, HalfHeight는 반구 포함
+        Out.Add(0.5f * (FMath::Lerp(Root0, Root1, T0) + FMath::Lerp(Tip0, Tip1, T0)),
+            0.5f * (FMath::Lerp(Root0, Root1, T1) + FMath::Lerp(Tip0, Tip1, T1)),
+            FRotationMatrix::MakeFromZ(Axis).ToQuat(),
+            MakeSweepShape(0.5f * Axis.Size() + TraceConfig.Radius));
+    }
+}
 
-            if (TraceConfig.bDebugDraw)
-            {
-                DrawDebugBetween(A, B, bHit ? FColor::Red : FColor::Green, TraceConfig.DebugLifeTime);
-                DrawDebugBox(World, B, TraceConfig.BoxHalfExtents, Rot, bHit ? FColor::Red : FColor::Green, false, TraceConfig.DebugLifeTime);
-            }
+FCollisionShape UMeleeHitTracerComponent::MakeSweepShape(float CapsuleHalfHeight) const
+{
+    switch (TraceConfig.Shape)
+    {
+    case EMeleeTraceShape::Box:     return FCollisionShape::MakeBox(TraceConfig.BoxHalfExtents);
+    case EMeleeTraceShape::Capsule: return FCollisionShape::MakeCapsule(TraceConfig.Radius, CapsuleHalfHeight);
+    default:                        return FCollisionShape::MakeSphere(TraceConfig.Radius);
+    }
+}
 
-            if (bHit)
-            {
-                for (const FHitResult& H : Hits)
-                {
-                    HandleHit(H, Dir.GetSafeNormal());
-                }
-            }
+bool UMeleeHitTracerComponent::ServerConfirmClaimedHit(AActor* Target, float ClientTime, FVector ClaimedImpactPoint)
+{
+    AActor* Owner = GetOwner();
+    UWorld* World = GetWorld();
+    if (!Target || !Owner || !World || !Owner->HasAuthority()) return false;
+
+    // 1) 시간 창: 너무 오래된/미래의 타임스탬프, 스윙 밖(트레이스 창이 닫혀 있던 시각) 거부
+    const float Now = World->GetTimeSeconds();
+    if (ClientTime > Now || Now - ClientTime > MaxRewindSeconds) return false;
+    // 주장 시각이 속한 창에서 이미 적용된 대상이면 거부 (이후 창이 열려 AlreadyHit가 비워져도 유지)
+    const FTraceWindowSpan* Span = FindWindowSpan(ClientTime);
+    if (!Span) return false;
+    if (bHitEachActorOncePerWindow && !Span->Hits.CanHit(Target, ClientTime, ReHitInterval)) return false;
+
+    // 2) 거리: ClientTime 시점 공격자 위치 기준 리치 밖 주장 거부
+    const UMeleeTraceSubsystem* Sub = World->GetSubsystem<UMeleeTraceSubsystem>();
+    FTransform OwnerPastXf;
+    FBox OwnerPastBounds;
+    if (!Sub || !Sub->SampleTargetPose(Owner, ClientTime, OwnerPastXf, OwnerPastBounds)) return false;
+    if (FVector::DistSquared(OwnerPastXf.GetLocation(), ClaimedImpactPoint) > FMath::Square(MaxClaimDistance)) return false;
+
+    // 3) 과거 바운드: 쿼리 없이 1차 판정
+    FTransform PastXf;
+    FBox PastBounds;
+    if (!Sub->SampleTargetPose(Target, ClientTime, PastXf, PastBounds)) return false;
+
+    const float Slack = TraceConfig.Radius + ClaimTolerance;
+    if (!PastBounds.ExpandBy(Slack).IsInside(ClaimedImpactPoint)) return false;
+
+    // 4) 정밀 판정: 대상은 옮기지 않고, 주장 지점을 과거 포즈 → 현재 포즈로 옮겨 대상 컴포넌트에만 오버랩 (씬 쿼리 아님)
+    const FVector LocalPoint = MeleeRewind::MapToCurrent(PastXf, Target->GetActorTransform(), ClaimedImpactPoint);
+    UPrimitiveComponent* HitComp = nullptr;
+    const FCollisionShape Probe = FCollisionShape::MakeSphere(Slack);
+    Target->ForEachComponent<UPrimitiveComponent>(false, [&](UPrimitiveComponent* Prim)
+    {
+        if (!HitComp && Prim->IsCollisionEnabled()
+            && Prim->GetCollisionResponseToChannel(TraceConfig.TraceChannel) != ECR_Ignore
+            && Prim->OverlapComponent(LocalPoint, FQuat::Identity, Probe))
+        {
+            HitComp = Prim;
         }
-    }
+    });
+    if (!HitComp) return false;
+
+    const FVector Dir = (ClaimedImpactPoint - OwnerPastXf.GetLocation()).GetSafeNormal();
+    FHitResult Hit(Target, HitComp, ClaimedImpactPoint, -Dir);
+    CurrentHitTime = ClientTime;
+    HandleHit(Hit, Dir);
+    return true;
+}
+
+void UMeleeHitTracerComponent::ServerClaimHit_Implementation(AActor* Target, float ClientTime, FVector_NetQuantize ImpactPoint)
+{
+    ServerConfirmClaimedHit(Target, ClientTime, ImpactPoint);
+}
+
+void UMeleeHitTracerComponent::ClaimHitOnServer(const FHitResult& Hit)
+{
+    const AActor* Owner = GetOwner();
+    const UWorld* World = GetWorld();
+    if (!bServerAuthoritative || !Owner || !World || Owner->GetLocalRole() != ROLE_AutonomousProxy) return;
+
+    // 로컬 히트 시각 → 서버 월드 시각
+    const AGameStateBase* GS = World->GetGameState();
+    const float ServerNow = GS ? GS->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
+    const float ServerHitTime = ServerNow - (World->GetTimeSeconds() - CurrentHitTime);
+    ServerClaimHit(Hit.GetActor(), ServerHitTime, Hit.ImpactPoint);
 }
 
-void UMeleeHitTracerComponent::HandleHit(const FHitResult& Hit, const FVector& SweepDir)
+bool UMeleeHitTracerComponent::HandleHit(const FHitResult& Hit, const FVector& SweepDir)
 {
+    COMBAT_SCOPE(STAT_CombatMeleeHandleHit);
     AActor* Other = Hit.GetActor();
-    if (!Other) return;
+    if (!Other) return false;
 
-    if (bHitEachActorOncePerWindow && AlreadyHit.Contains(Other))
+    FMeleeHitCache& HitCache = GetHitCacheForCurrentTime();
+    if (bHitEachActorOncePerWindow && !HitCache.CanHit(Other, CurrentHitTime, ReHitInterval))
     {
-        return;
+        return false;
     }
 
     // 서버 권위 적용
@@ -205,10 +472,19 @@ void UMeleeHitTracerComponent::HandleHit(const FHitResult& Hit, const FVector& S
         UGameplayStatics::ApplyPointDamage(
             Other, Damage, SweepDir.IsNearlyZero() ? (GetOwner() ? GetOwner()->GetActorForwardVector() : FVector::ForwardVector) : SweepDir,
             Hit, InstigatorCtrl, GetOwner(), DamageTypeClass ? *DamageTypeClass : UDamageType::StaticClass());
+        INC_DWORD_STAT(STAT_CombatDamageEvents);
     }
 
-    AlreadyHit.Add(Other);
+    INC_DWORD_STAT(STAT_CombatHits);
+    COMBAT_TRACE_EVENT(TEXT("MeleeHit %s -> %s (%.1f)"), *GetNameSafe(GetOwner()), *Other->GetName(), Damage);
+
+    HitCache.MarkHit(Other, CurrentHitTime);
+    if (!bCanApplyDamage)
+    {
+        ClaimHitOnServer(Hit);
+    }
     OnHit.Broadcast(Hit);
+    return true;
 }
 
 void UMeleeHitTracerComponent::DrawDebugBetween(const FVector& A, const FVector& B, const FColor& Color, float LifeTime) const
@@ -218,3 +494,18 @@ void UMeleeHitTracerComponent::DrawDebugBetween(const FVector& A, const FVector&
         DrawDebugLine(World, A, B, Color, false, LifeTime, 0, 1.f);
     }
 }
+
+void UMeleeHitTracerComponent::DrawSweepDebug(const FVector& A, const FVector& B, const FQuat& Rot, const FCollisionShape& Shape, bool bHit) const
+{
+    UWorld* World = GetWorld();
+    if (!TraceConfig.bDebugDraw || !World) return;
+
+    const FColor Color = bHit ? FColor::Red : FColor::Green;
+    DrawDebugBetween(A, B, Color, TraceConfig.DebugLifeTime);
+    if (Shape.IsSphere())
+        DrawDebugSphere(World, B, Shape.GetSphereRadius(), 12, Color, false, TraceConfig.DebugLifeTime);
+    else if (Shape.IsBox())
+        DrawDebugBox(World, B, Shape.GetBox(), Rot, Color, false, TraceConfig.DebugLifeTime);
+    else if (Shape.IsCapsule())
+        DrawDebugCapsule(World, B, Shape.GetCapsuleHalfHeight(), Shape.GetCapsuleRadius(), Rot, Color, false, TraceConfig.DebugLifeTime);
+}
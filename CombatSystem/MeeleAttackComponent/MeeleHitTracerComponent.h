@@ -4,6 +4,9 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "CollisionShape.h"
+#include "MeleeHitCache.h"
+#include "MeleeTraceSubsystem.h"
 #include "MeleeHitTracerComponent.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FMeleeHitDelegate, const FHitResult&, Hit);
@@ -13,7 +16,16 @@ UENUM(BlueprintType)
 enum class EMeleeTraceShape : uint8
 {
     Sphere  UMETA(DisplayName = "Sphere"),
-    Box     UMETA(DisplayName = "Box")
+    Box     UMETA(DisplayName = "Box"),
+    Capsule UMETA(DisplayName = "Capsule (Blade Volume)") // 루트~팁 전체를 캡슐 하나로 스윕
+};
+
+// 프레임 사이 블레이드 포즈 보간 방식
+UENUM(BlueprintType)
+enum class EMeleeTraceInterp : uint8
+{
+    Linear  UMETA(DisplayName = "Linear"),
+    Arc     UMETA(DisplayName = "Arc (Pivot Slerp)") // 피벗 기준 회전 보간: 저틱 서버에서 호를 현으로 자르지 않음
 };
 
 USTRUCT(BlueprintType)
@@ -24,13 +36,17 @@ struct FMeleeTraceConfig
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Trace")
     EMeleeTraceShape Shape = EMeleeTraceShape::Sphere;
 
-    // Sphere
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Trace", meta = (EditCondition = "Shape==EMeleeTraceShape::Sphere", ClampMin = "1.0"))
+    // Sphere / Capsule
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Trace", meta = (EditCondition = "Shape!=EMeleeTraceShape::Box", ClampMin = "1.0"))
     float Radius = 8.f;
 
     // Box (Half extents)
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Trace", meta = (EditCondition = "Shape==EMeleeTraceShape::Box"))
-    FVector BoxHalfExtents = FVector(6, 3, 3);
+    FVector BoxHalfExtents = FVector(6, 3, 3); // X = 블레이드 축
+
+    // Sphere/Box: 루트~팁 사이 샘플 수 (Capsule은 무시)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Trace", meta = (EditCondition = "Shape!=EMeleeTraceShape::Capsule", ClampMin = "1"))
+    int32 SamplesAlongBlade = 3;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Trace")
     TEnumAsByte<ECollisionChannel> TraceChannel = ECC_GameTraceChannel1; // e.g., MeleeTrace
@@ -41,6 +57,20 @@ struct FMeleeTraceConfig
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Trace", meta = (ClampMin = "1"))
     int32 ExtraSubdivisions = 1; // 추가 샘플 분할(과도한 터널링 방지)
 
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Trace")
+    EMeleeTraceInterp Interpolation = EMeleeTraceInterp::Linear;
+
+    // 회전 피벗 소켓 (WeaponMesh 기준, 없으면 소유 액터 위치)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Trace", meta = (EditCondition = "Interpolation==EMeleeTraceInterp::Arc"))
+    FName ArcPivotSocketName = NAME_None;
+
+    // 서브프레임 포즈 하나가 담당하는 최대 회전각(도)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Trace", meta = (EditCondition = "Interpolation==EMeleeTraceInterp::Arc", ClampMin = "1.0"))
+    float MaxArcStepDegrees = 15.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Trace", meta = (EditCondition = "Interpolation==EMeleeTraceInterp::Arc", ClampMin = "1"))
+    int32 MaxArcSubframes = 8;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Debug")
     bool bDebugDraw = false;
 
@@ -81,14 +111,46 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Damage")
     bool bHitEachActorOncePerWindow = true;
 
+    // 0이면 창당 1회, 0보다 크면 같은 액터를 이 간격(초)마다 다시 타격
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Damage", meta = (EditCondition = "bHitEachActorOncePerWindow", ClampMin = "0.0"))
+    float ReHitInterval = 0.f;
+
     // 네트워크: 서버에서만 대미지 확정 (권장)
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Networking")
     bool bServerAuthoritative = true;
 
+    // 외부 스텝 구동(고정 스텝 전투 클럭): 서브시스템 프레임 패스 대신 StepTrace 호출로만 스윕
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Trace")
+    bool bExternallyStepped = false;
+
+    // 래그 보상: 클라이언트 타임스탬프를 이 시간(초)보다 과거로 되감지 않음
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Networking", meta = (ClampMin = "0.0"))
+    float MaxRewindSeconds = 0.5f;
+
+    // 주장된 히트 지점 허용 오차 (과거 바운드 확장량)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Networking", meta = (ClampMin = "0.0"))
+    float ClaimTolerance = 20.f;
+
+    // 주장된 히트 시각이 서버 트레이스 창 밖이어도 허용하는 여유(초). 서버 창은 지연 보상으로 앞당겨지지만 경계 오차가 남는다
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Networking", meta = (ClampMin = "0.0"))
+    float ClaimWindowSlack = 0.05f;
+
+    // 공격자(ClientTime 시점으로 되감은 위치)로부터 주장된 히트 지점까지 최대 거리
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Networking", meta = (ClampMin = "0.0"))
+    float MaxClaimDistance = 300.f;
+
     // 자기 자신/소유자 무시
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Trace")
     bool bIgnoreOwner = true;
 
+    // 비동기 스윕: 이번 프레임에 제출하고 다음 프레임에 결과 처리 (게임 스레드 블로킹 없음)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Trace")
+    bool bUseAsyncTrace = false;
+
+    // 비동기 결과의 히트 시각을 제출 시점으로 되감기 (대미지 순서 보정)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee|Trace", meta = (EditCondition = "bUseAsyncTrace"))
+    bool bRewindAsyncHitTime = true;
+
     // 활성화/비활성화
     UFUNCTION(BlueprintCallable, Category = "Melee")
     void StartTrace();
@@ -96,8 +158,23 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Melee")
     void StopTrace(bool bClearHitCache = true);
 
+    UFUNCTION(BlueprintPure, Category = "Melee")
+    bool IsTracing() const { return bActive; }
+
+    // 고정 스텝 1회분 즉시 스윕. FrameAlpha = 이번 프레임 안에서의 스텝 위치 (0~1)
+    void StepTrace(float FrameAlpha);
+
+    // 서버: 클라이언트 예측 스윙이 주장한 히트를 ClientTime 시점의 대상 포즈로 되감아 검증 후 적용
+    // (대상에 UMeleeRewindTargetComponent 필요). ClientTime에 트레이스 창이 열려 있지 않았으면 거부
+    UFUNCTION(BlueprintCallable, Category = "Melee|Networking")
+    bool ServerConfirmClaimedHit(AActor* Target, float ClientTime, FVector ClaimedImpactPoint);
+
+    // 현재 처리 중인 히트의 월드 시각 (OnHit 안에서 유효)
+    UFUNCTION(BlueprintPure, Category = "Melee")
+    float GetHitTimestamp() const { return CurrentHitTime; }
+
     UFUNCTION(BlueprintCallable, Category = "Melee")
-    void SetWeaponMesh(USkeletalMeshComponent* InMesh) { WeaponMesh = InMesh; }
+    void SetWeaponMesh(USkeletalMeshComponent* InMesh) { WeaponMesh = InMesh; if (bActive) BuildQueryParams(CachedQueryParams); }
 
     UFUNCTION(BlueprintCallable, Category = "Melee")
     void SetSockets(FName InRoot, FName InTip) { RootSocketName = InRoot; TipSocketName = InTip; }
@@ -109,34 +186,80 @@ public:
 protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
-public:	
-	// Called every frame
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+    // 소유 클라이언트 → 서버: 예측 스윙의 히트 주장 (서버 월드 시각 + 양자화 지점)
+    UFUNCTION(Server, Reliable)
+    void ServerClaimHit(AActor* Target, float ClientTime, FVector_NetQuantize ImpactPoint);
 
 private:
+    // 스윕 수집/실행/디스패치는 월드 서브시스템이 일괄 처리
+    friend class UMeleeTraceSubsystem;
+
+    // 서버: 최근 트레이스 창 구간과 그 창에서 적용된 히트 (주장된 히트 시각 검증/창별 중복 판정용, 진행 중이면 End = FLT_MAX)
+    struct FTraceWindowSpan
+    {
+        uint32 WindowId = 0;
+        float Start = -FLT_MAX;
+        float End = -FLT_MAX;
+        FMeleeHitCache Hits;
+    };
+    static constexpr int32 NumWindowSpans = 4;
+    FTraceWindowSpan WindowSpans[NumWindowSpans];
+    int32 WindowSpanHead = 0;
+
+    // Time이 속한 창 (최신 창 우선, ClaimWindowSlack 허용). 없으면 null
+    FTraceWindowSpan* FindWindowSpan(float Time);
+
+    // CurrentHitTime 기준 중복 판정 캐시: 서버는 그 시각의 창 캐시, 그 외엔 현재 창의 AlreadyHit
+    FMeleeHitCache& GetHitCacheForCurrentTime();
+
+    // 소유 클라이언트의 로컬 히트를 서버에 주장 (서버 권위 + 예측 중일 때만)
+    void ClaimHitOnServer(const FHitResult& Hit);
+
     bool bActive = false;
     bool bHasPrev = false;
 
+    // 창 식별자: StartTrace/캐시 삭제 StopTrace마다 증가 → 이전 창의 비동기 결과 폐기
+    uint32 TraceWindowId = 0;
+    float CurrentHitTime = 0.f;
+
     // 이전 프레임의 소켓 월드 좌표
     FVector PrevRoot = FVector::ZeroVector;
     FVector PrevTip = FVector::ZeroVector;
+    FVector PrevPivot = FVector::ZeroVector;
+
+    // StepTrace 전용: 프레임 시작 포즈와 스텝 배치
+    uint64 StepFrameNumber = 0;
+    FVector FrameStartRoot = FVector::ZeroVector;
+    FVector FrameStartTip = FVector::ZeroVector;
+    FVector FrameStartPivot = FVector::ZeroVector;
+    FMeleeSweepBatch StepBatch;
 
     // 중복 타격 방지
-    TSet<TWeakObjectPtr<AActor>> AlreadyHit;
+    FMeleeHitCache AlreadyHit;
 
-    // 공통 쿼리 파라미터
+    // 공통 쿼리 파라미터 (StartTrace에서 한 번만 빌드해 윈도우 동안 재사용)
+    FCollisionQueryParams CachedQueryParams;
     void BuildQueryParams(FCollisionQueryParams& OutQP) const;
 
-    void DoFrameSweep();
-    void SweepSegment(const FVector& Start, const FVector& End);
-    void HandleHit(const FHitResult& Hit, const FVector& SweepDir);
+    // 이번 프레임 서브스텝을 서브시스템 배치에 적재
+    void GatherFrameSweeps(FMeleeSweepBatch& Out);
+    void GatherSweepsToPose(FMeleeSweepBatch& Out, const FVector& CurrRoot, const FVector& CurrTip, const FVector& CurrPivot);
+    void SweepBladePose(FMeleeSweepBatch& Out, const FVector& Root0, const FVector& Tip0, const FVector& Root1, const FVector& Tip1);
+    void SweepSegment(FMeleeSweepBatch& Out, const FVector& Start, const FVector& End, const FQuat& StartRot, const FQuat& EndRot);
+    void SweepBladeVolume(FMeleeSweepBatch& Out, const FVector& Root0, const FVector& Tip0, const FVector& Root1, const FVector& Tip1);
+    int32 ComputeStepCount(float Dist) const;
+    FCollisionShape MakeSweepShape(float CapsuleHalfHeight) const;
+    bool HandleHit(const FHitResult& Hit, const FVector& SweepDir); // 적용(중복 아님)되면 true
 
     // 디버그
     void DrawDebugBetween(const FVector& A, const FVector& B, const FColor& Color, float LifeTime) const;
+    void DrawSweepDebug(const FVector& A, const FVector& B, const FQuat& Rot, const FCollisionShape& Shape, bool bHit) const;
 
     // 유틸: 현재 소켓 위치 쌍
     bool GetCurrentBladePoints(FVector& OutRoot, FVector& OutTip) const;
+    FVector GetCurrentPivot() const;
 
     // 적용 주체(컨트롤러/인스티게이터)
     AController* GetInstigatorControllerSafe() const;
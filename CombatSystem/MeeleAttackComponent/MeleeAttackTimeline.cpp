@@ -0,0 +1,113 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "MeleeAttackTimeline.h"
+#include "Curves/CurveFloat.h"
+
+void UMeleeAttackTimeline::PostLoad()
+{
+    Super::PostLoad();
+    Rebuild();
+}
+
+void UMeleeAttackTimeline::BeginDestroy()
+{
+#if WITH_EDITOR
+    UnwatchCurves();
+#endif
+    Super::BeginDestroy();
+}
+
+#if WITH_EDITOR
+void UMeleeAttackTimeline::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+    // 밸런스 핫 리로드: 참조 중인 컴포넌트는 다음 틱부터 새 값을 읽음
+    Rebuild();
+}
+
+void UMeleeAttackTimeline::WatchCurves()
+{
+    UnwatchCurves();
+    for (const FMeleeAttackSpec& Spec : Attacks)
+    {
+        if (UCurveFloat* Curve = Spec.RadiusScaleCurve; Curve && !WatchedCurves.Contains(Curve))
+        {
+            Curve->OnUpdateCurve.AddUObject(this, &UMeleeAttackTimeline::OnCurveUpdated);
+            WatchedCurves.Add(Curve);
+        }
+    }
+}
+
+void UMeleeAttackTimeline::UnwatchCurves()
+{
+    for (const TWeakObjectPtr<UCurveFloat>& Curve : WatchedCurves)
+    {
+        if (Curve.IsValid()) Curve->OnUpdateCurve.RemoveAll(this);
+    }
+    WatchedCurves.Reset();
+}
+
+void UMeleeAttackTimeline::OnCurveUpdated(UCurveBase* Curve, EPropertyChangeType::Type ChangeType)
+{
+    // 커브 에셋 편집(키 이동 등)도 타임라인 편집과 같이 즉시 다시 굽기
+    Rebuild();
+}
+#endif
+
+void UMeleeAttackTimeline::Rebuild()
+{
+    const int32 SampleCount = FMath::Clamp(RadiusSampleCount, 2, 128);
+
+    PhaseDurations.SetNum(Attacks.Num() * 3);
+    NextIndices.SetNum(Attacks.Num());
+    RadiusOffsets.SetNum(Attacks.Num());
+    RadiusSamples.Reset();
+
+    for (int32 i = 0; i < Attacks.Num(); ++i)
+    {
+        const FMeleeAttackSpec& Spec = Attacks[i];
+        PhaseDurations[i * 3 + 0] = FMath::Max(0.f, Spec.WarmupTime);
+        PhaseDurations[i * 3 + 1] = FMath::Max(0.f, Spec.ActiveTime);
+        PhaseDurations[i * 3 + 2] = FMath::Max(0.f, Spec.RecoveryTime);
+        NextIndices[i] = Attacks.IsValidIndex(Spec.NextIndex) ? Spec.NextIndex : INDEX_NONE;
+    }
+
+    for (int32 i = 0; i < Attacks.Num(); ++i)
+    {
+        UCurveFloat* Curve = Attacks[i].RadiusScaleCurve;
+        if (!Curve)
+        {
+            RadiusOffsets[i] = INDEX_NONE;
+            continue;
+        }
+        // PostLoad 순서는 보장되지 않음 → 키가 로드되기 전에 샘플링하지 않도록
+        Curve->ConditionalPostLoad();
+
+        RadiusOffsets[i] = RadiusSamples.Num();
+        for (int32 s = 0; s < SampleCount; ++s)
+        {
+            RadiusSamples.Add(Curve->GetFloatValue((float)s / (float)(SampleCount - 1)));
+        }
+    }
+
+#if WITH_EDITOR
+    if (!HasAnyFlags(RF_ClassDefaultObject))
+    {
+        WatchCurves();
+    }
+#endif
+}
+
+bool UMeleeAttackTimeline::SampleRadiusScale(int32 Index, float Alpha, float& OutScale) const
+{
+    if (!RadiusOffsets.IsValidIndex(Index) || RadiusOffsets[Index] == INDEX_NONE) return false;
+
+    const int32 SampleCount = FMath::Clamp(RadiusSampleCount, 2, 128);
+    const float X = FMath::Clamp(Alpha, 0.f, 1.f) * (SampleCount - 1);
+    const int32 I0 = FMath::Min(FMath::FloorToInt(X), SampleCount - 2);
+    const float* Samples = RadiusSamples.GetData() + RadiusOffsets[Index];
+
+    OutScale = FMath::Lerp(Samples[I0], Samples[I0 + 1], X - I0);
+    return true;
+}
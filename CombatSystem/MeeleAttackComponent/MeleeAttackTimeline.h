@@ -0,0 +1,77 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "MeeleAttackComponent.h"
+#include "MeleeAttackTimeline.generated.h"
+
+/**
+ * 공유 공격 타임라인 (불변 데이터 에셋).
+ * 컴포넌트는 인스턴스마다 스펙을 복사하지 않고 인덱스로만 참조한다.
+ * 반경 커브는 로드/편집 시 고정 개수 샘플로 미리 구워 틱마다 커브를 평가하지 않는다.
+ * 페이즈 길이와 콤보 링크도 연속 배열로 구워, 페이즈 전환/입력 해석이 스펙 구조체를 건드리지 않는다.
+ */
+UCLASS(BlueprintType)
+class PROJECT_NAME_API UMeleeAttackTimeline : public UPrimaryDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    // 작성용 스펙 (NextIndex 콤보 링크 포함)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Attack")
+    TArray<FMeleeAttackSpec> Attacks;
+
+    // 커브당 베이크 샘플 수
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Attack", meta = (ClampMin = "2", ClampMax = "128"))
+    int32 RadiusSampleCount = 16;
+
+    const FMeleeAttackSpec* GetSpec(int32 Index) const { return Attacks.IsValidIndex(Index) ? &Attacks[Index] : nullptr; }
+    int32 Num() const { return Attacks.Num(); }
+
+    // 베이크된 페이즈 길이 (Idle/범위 밖 = 0)
+    float GetPhaseDuration(int32 Index, EAttackPhase Phase) const
+    {
+        const int32 Slot = (int32)Phase - (int32)EAttackPhase::Warmup;
+        return (Phase != EAttackPhase::Idle && NextIndices.IsValidIndex(Index)) ? PhaseDurations[Index * 3 + Slot] : 0.f;
+    }
+
+    // 베이크된 콤보 링크 (범위 밖 링크/인덱스 = INDEX_NONE)
+    int32 GetNextIndex(int32 Index) const { return NextIndices.IsValidIndex(Index) ? NextIndices[Index] : INDEX_NONE; }
+
+    bool HasRadiusCurve(int32 Index) const { return RadiusOffsets.IsValidIndex(Index) && RadiusOffsets[Index] != INDEX_NONE; }
+
+    // 베이크된 반경 배율 (커브 없으면 false)
+    bool SampleRadiusScale(int32 Index, float Alpha, float& OutScale) const;
+
+    // 스펙 → 평탄화 테이블 재생성
+    void Rebuild();
+
+    virtual void PostLoad() override;
+    virtual void BeginDestroy() override;
+#if WITH_EDITOR
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+#if WITH_EDITOR
+    // 참조 커브 에셋 편집 시에도 다시 굽기 위해 구독 중인 커브
+    TArray<TWeakObjectPtr<UCurveFloat>> WatchedCurves;
+    void WatchCurves();
+    void UnwatchCurves();
+    void OnCurveUpdated(UCurveBase* Curve, EPropertyChangeType::Type ChangeType);
+#endif
+
+    // 공격별 [Warmup, Active, Recovery] 길이 (Index * 3 + 페이즈)
+    TArray<float> PhaseDurations;
+
+    // 공격별 다음 콤보 인덱스
+    TArray<int32> NextIndices;
+
+    // 공격별 RadiusSamples 시작 오프셋 (INDEX_NONE = 커브 없음)
+    TArray<int32> RadiusOffsets;
+
+    // 모든 공격의 반경 샘플을 이어 붙인 평탄 버퍼
+    TArray<float> RadiusSamples;
+};
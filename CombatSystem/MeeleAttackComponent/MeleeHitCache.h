@@ -0,0 +1,61 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class AActor;
+
+/**
+ * 근접 창 단위 중복 타격 캐시.
+ * 한 번의 스윙은 보통 8개 미만의 액터만 건드리므로 인라인 버퍼 + 선형 탐색(오브젝트 인덱스/시리얼 비교)으로 처리.
+ * Reset은 용량을 유지하므로 창마다 힙 할당이 없다.
+ */
+struct FMeleeHitCache
+{
+    // ReHitInterval <= 0 이면 창당 1회, > 0 이면 해당 간격 이후 재타격 허용(다단히트 회전베기 등)
+    bool CanHit(const AActor* Actor, float Now, float ReHitInterval) const
+    {
+        const int32 Index = Find(Actor);
+        if (Index == INDEX_NONE) return true;
+        return ReHitInterval > 0.f && (Now - Entries[Index].LastHitTime) >= ReHitInterval;
+    }
+
+    void MarkHit(const AActor* Actor, float Now)
+    {
+        const int32 Index = Find(Actor);
+        if (Index != INDEX_NONE)
+        {
+            Entries[Index].LastHitTime = Now;
+            return;
+        }
+        Entries.Add({ TWeakObjectPtr<const AActor>(Actor), Now });
+    }
+
+    bool Contains(const AActor* Actor) const { return Find(Actor) != INDEX_NONE; }
+
+    void Reset() { Entries.Reset(); }
+
+    int32 Num() const { return Entries.Num(); }
+
+private:
+    struct FEntry
+    {
+        TWeakObjectPtr<const AActor> Actor;
+        float LastHitTime = 0.f;
+    };
+
+    TArray<FEntry, TInlineAllocator<8>> Entries;
+
+    int32 Find(const AActor* Actor) const
+    {
+        // 약참조를 역참조하지 않고 인덱스/시리얼만 비교
+        const TWeakObjectPtr<const AActor> Key(Actor);
+        for (int32 i = 0; i < Entries.Num(); ++i)
+        {
+            if (Entries[i].Actor.HasSameIndexAndSerialNumber(Key)) return i;
+        }
+        return INDEX_NONE;
+    }
+};
@@ -0,0 +1,71 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StaticArray.h"
+
+// 한 시점의 액터 트랜스폼/바운드
+struct FMeleePoseSample
+{
+    float Time = -FLT_MAX;
+    FTransform Transform = FTransform::Identity;
+    FBox Bounds = FBox(ForceInit);
+};
+
+/**
+ * 래그 보상용 고정 크기 포즈 히스토리 (링 버퍼).
+ * 메모리는 Capacity로 고정되고, 기록/조회 모두 할당이 없다.
+ */
+struct FMeleePoseHistory
+{
+    static constexpr int32 Capacity = 64; // 60Hz 기준 약 1초
+
+    void Record(float Time, const FTransform& Transform, const FBox& Bounds)
+    {
+        Head = (Head + 1) % Capacity;
+        FMeleePoseSample& S = Samples[Head];
+        S.Time = Time;
+        S.Transform = Transform;
+        S.Bounds = Bounds;
+        Count = FMath::Min(Count + 1, Capacity);
+    }
+
+    void Reset() { Head = INDEX_NONE; Count = 0; }
+
+    float GetOldestTime() const { return Count > 0 ? At(Count - 1).Time : FLT_MAX; }
+    float GetNewestTime() const { return Count > 0 ? At(0).Time : -FLT_MAX; }
+
+    // Time 시점의 포즈를 인접 두 샘플 보간으로 복원. 기록 범위를 벗어나면 false
+    bool Sample(float Time, FTransform& OutTransform, FBox& OutBounds) const
+    {
+        if (Count == 0 || Time < GetOldestTime() || Time > GetNewestTime()) return false;
+
+        // 최신 → 과거 순으로 Time을 감싸는 구간 탐색
+        for (int32 Age = 0; Age < Count - 1; ++Age)
+        {
+            const FMeleePoseSample& Newer = At(Age);
+            const FMeleePoseSample& Older = At(Age + 1);
+            if (Time >= Older.Time)
+            {
+                const float Span = Newer.Time - Older.Time;
+                const float Alpha = Span > KINDA_SMALL_NUMBER ? (Time - Older.Time) / Span : 1.f;
+                OutTransform.Blend(Older.Transform, Newer.Transform, Alpha);
+                OutBounds = FBox(FMath::Lerp(Older.Bounds.Min, Newer.Bounds.Min, Alpha), FMath::Lerp(Older.Bounds.Max, Newer.Bounds.Max, Alpha));
+                return true;
+            }
+        }
+
+        OutTransform = At(0).Transform;
+        OutBounds = At(0).Bounds;
+        return true;
+    }
+
+private:
+    TStaticArray<FMeleePoseSample, Capacity> Samples;
+    int32 Head = INDEX_NONE;
+    int32 Count = 0;
+
+    // Age 0 = 최신
+    const FMeleePoseSample& At(int32 Age) const { return Samples[(Head - Age + Capacity) % Capacity]; }
+};
@@ -0,0 +1,40 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "MeleeRewindTargetComponent.h"
+#include "MeleeTraceSubsystem.h"
+#include "GameFramework/Actor.h"
+#include "Engine/World.h"
+
+
+UMeleeRewindTargetComponent::UMeleeRewindTargetComponent()
+{
+    PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UMeleeRewindTargetComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    // 히스토리는 검증을 수행하는 서버에서만 필요
+    AActor* Owner = GetOwner();
+    if (Owner && Owner->HasAuthority())
+    {
+        if (UMeleeTraceSubsystem* Sub = GetWorld()->GetSubsystem<UMeleeTraceSubsystem>())
+        {
+            Sub->RegisterRewindTarget(Owner);
+        }
+    }
+}
+
+void UMeleeRewindTargetComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UWorld* World = GetWorld())
+    {
+        if (UMeleeTraceSubsystem* Sub = World->GetSubsystem<UMeleeTraceSubsystem>())
+        {
+            Sub->UnregisterRewindTarget(GetOwner());
+        }
+    }
+    Super::EndPlay(EndPlayReason);
+}
@@ -0,0 +1,24 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "MeleeRewindTargetComponent.generated.h"
+
+/**
+ * 서버에서 소유 액터의 포즈 히스토리를 기록하도록 UMeleeTraceSubsystem에 등록하는 마커 컴포넌트.
+ * 클라이언트 예측 스윙의 히트 검증 대상(적/더미)에 붙인다. 자체 틱 없음.
+ */
+UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
+class PROJECT_NAME_API UMeleeRewindTargetComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:	
+	UMeleeRewindTargetComponent();
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+};
@@ -0,0 +1,490 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "MeleeTraceSubsystem.h"
+#include "MeleeHitTracerComponent.h"
+#include "MeeleAttackComponent.h"
+#include "CombatStats.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
+
+static TAutoConsoleVariable<int32> CVarMeleeTraceParallelMinSweeps(
+    TEXT("Melee.Trace.ParallelMinSweeps"),
+    0,
+    TEXT("스윕 수가 이 값 이상이면 ParallelFor로 쿼리 실행 (0 = 항상 게임 스레드)"));
+
+static FAutoConsoleCommandWithWorldAndArgs CmdMeleeBenchRecord(
+    TEXT("Melee.Bench.Record"),
+    TEXT("Melee.Bench.Record <Frames> [Name] : 근접 트레이스 프레임 통계를 CSV로 기록 (-nullrhi 헤드리스 실행 가능)"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+        UMeleeTraceSubsystem* Sub = World ? World->GetSubsystem<UMeleeTraceSubsystem>() : nullptr;
+        if (!Sub) return;
+        const int32 Frames = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 600;
+        Sub->StartBenchmark(Frames, Args.Num() > 1 ? Args[1] : TEXT("MeleeBench"));
+    }));
+
+static FAutoConsoleCommandWithWorldAndArgs CmdMeleeBenchRun(
+    TEXT("Melee.Bench.Run"),
+    TEXT("Melee.Bench.Run <Attackers> <Dummies> <Frames> [Name] : 콤보 공격자/더미를 스폰해 매 프레임 공격 입력을 넣으며 Melee.Bench.Record와 같은 CSV 기록"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+        UMeleeTraceSubsystem* Sub = World ? World->GetSubsystem<UMeleeTraceSubsystem>() : nullptr;
+        if (!Sub) return;
+        const int32 Attackers = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 32;
+        const int32 Dummies = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 64;
+        const int32 Frames = Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 600;
+        const FString Name = Args.Num() > 3 ? Args[3] : FString::Printf(TEXT("MeleeBenchRun_%dx%d"), Attackers, Dummies);
+        Sub->RunBenchmark(Attackers, Dummies, Frames, Name);
+    }));
+
+namespace MeleeBench
+{
+    // 벤치 액터 배치: 다른 지오메트리와 겹치지 않게 월드 위쪽 격자
+    const FVector Origin(0.f, 0.f, 50000.f);
+    constexpr float Spacing = 400.f;
+    constexpr float BladeReach = 120.f;   // 공격자 중심 → 블레이드 소켓 컴포넌트 거리
+    constexpr float SpinDegPerSec = 540.f;
+}
+
+void UMeleeTraceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    AsyncSweepDelegate.BindUObject(this, &UMeleeTraceSubsystem::OnAsyncSweepDone);
+}
+
+void UMeleeTraceSubsystem::RegisterTracer(UMeleeHitTracerComponent* Tracer)
+{
+    if (Tracer)
+    {
+        ActiveTracers.AddUnique(Tracer);
+    }
+}
+
+void UMeleeTraceSubsystem::UnregisterTracer(UMeleeHitTracerComponent* Tracer)
+{
+    ActiveTracers.RemoveSwap(Tracer);
+}
+
+void UMeleeTraceSubsystem::RegisterRewindTarget(AActor* Actor)
+{
+    if (!Actor) return;
+    for (const FMeleeRewindTarget& T : RewindTargets)
+    {
+        if (T.Actor == Actor) return;
+    }
+    RewindTargets.AddDefaulted_GetRef().Actor = Actor;
+}
+
+void UMeleeTraceSubsystem::UnregisterRewindTarget(AActor* Actor)
+{
+    RewindTargets.RemoveAllSwap([Actor](const FMeleeRewindTarget& T) { return T.Actor == Actor; });
+}
+
+bool UMeleeTraceSubsystem::SampleTargetPose(const AActor* Actor, float Time, FTransform& OutTransform, FBox& OutBounds) const
+{
+    for (const FMeleeRewindTarget& T : RewindTargets)
+    {
+        if (T.Actor == Actor)
+        {
+            return T.History.Sample(Time, OutTransform, OutBounds);
+        }
+    }
+    return false;
+}
+
+void UMeleeTraceSubsystem::RecordRewindHistory(float Now)
+{
+    for (int32 i = RewindTargets.Num() - 1; i >= 0; --i)
+    {
+        const AActor* Actor = RewindTargets[i].Actor.Get();
+        if (!IsValid(Actor))
+        {
+            RewindTargets.RemoveAtSwap(i);
+            continue;
+        }
+
+        FVector Origin, Extent;
+        Actor->GetActorBounds(/*bOnlyCollidingComponents*/ true, Origin, Extent);
+        RewindTargets[i].History.Record(Now, Actor->GetActorTransform(), FBox(Origin - Extent, Origin + Extent));
+    }
+}
+
+TStatId UMeleeTraceSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMeleeTraceSubsystem, STATGROUP_Tickables);
+}
+
+void UMeleeTraceSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    UWorld* World = GetWorld();
+    if (!World) return;
+
+    FinishFrameStats(DeltaTime);
+    if (BenchAttackers.Num() > 0)
+    {
+        DriveBenchAttackers(DeltaTime);
+    }
+    COMBAT_SCOPE(STAT_CombatMeleeTracePass);
+    const double PassStart = FPlatformTime::Seconds();
+    ON_SCOPE_EXIT { FrameStats.TraceMs += (float)((FPlatformTime::Seconds() - PassStart) * 1000.0); };
+
+    // 0) 래그 보상 히스토리 (스윕 전에 이번 프레임 포즈 기록)
+    RecordRewindHistory(World->GetTimeSeconds());
+
+    // 1) 수집: 모든 활성 트레이서의 서브스텝을 하나의 SoA 버퍼로
+    FrameTracers.Reset();
+    Batch.Reset();
+    for (int32 i = ActiveTracers.Num() - 1; i >= 0; --i)
+    {
+        UMeleeHitTracerComponent* Tracer = ActiveTracers[i].Get();
+        if (!IsValid(Tracer) || !Tracer->IsTracing())
+        {
+            ActiveTracers.RemoveAtSwap(i);
+            continue;
+        }
+        if (Tracer->bExternallyStepped) continue; // 소유자가 StepTrace로 구동
+        Batch.BeginTracer(FrameTracers.Add(Tracer));
+        Tracer->GatherFrameSweeps(Batch);
+    }
+
+    FrameStats.ActiveTracers = FrameTracers.Num();
+    SET_DWORD_STAT(STAT_CombatActiveTracers, FrameTracers.Num());
+    const int32 NumSweeps = Batch.Num();
+    if (NumSweeps == 0) return;
+
+    // 2) 실행: 결과 버퍼는 줄이지 않고 재사용
+    if (SweepHits.Num() < NumSweeps)
+    {
+        SweepHits.SetNum(NumSweeps);
+        SweepBlocked.SetNum(NumSweeps);
+    }
+
+    // 비동기 트레이서는 제출만 (결과는 다음 프레임 OnAsyncSweepDone)
+    int32 NumAsync = 0;
+    for (int32 Index = 0; Index < NumSweeps; ++Index)
+    {
+        if (FrameTracers[Batch.TracerIndex[Index]]->bUseAsyncTrace)
+        {
+            SubmitAsyncSweep(World, Index);
+            ++NumAsync;
+        }
+    }
+
+    const int32 ParallelMin = CVarMeleeTraceParallelMinSweeps.GetValueOnGameThread();
+    {
+        COMBAT_SCOPE(STAT_CombatMeleeExecute);
+        if (ParallelMin > 0 && NumSweeps >= ParallelMin)
+        {
+            ParallelFor(NumSweeps, [this, World](int32 Index) { RunSweep(World, Index); });
+        }
+        else
+        {
+            for (int32 Index = 0; Index < NumSweeps; ++Index)
+            {
+                RunSweep(World, Index);
+            }
+        }
+    }
+    INC_DWORD_STAT_BY(STAT_CombatSweeps, NumSweeps);
+    INC_DWORD_STAT_BY(STAT_CombatAsyncSweeps, NumAsync);
+    FrameStats.Sweeps += NumSweeps;
+    FrameStats.AsyncSweeps += NumAsync;
+
+    // 3) 디스패치: 항상 게임 스레드, 트레이서별 제출 순서 유지
+    for (int32 Index = 0; Index < NumSweeps; ++Index)
+    {
+        UMeleeHitTracerComponent* Tracer = FrameTracers[Batch.TracerIndex[Index]];
+        // 앞선 히트 콜백에서 창이 닫혔으면 남은 스텝은 버림
+        if (!IsValid(Tracer) || !Tracer->IsTracing() || Tracer->bUseAsyncTrace) continue;
+
+        Tracer->CurrentHitTime = World->GetTimeSeconds();
+        const bool bHit = SweepBlocked[Index] != 0;
+        Tracer->DrawSweepDebug(Batch.Start[Index], Batch.End[Index], Batch.Rot[Index], Batch.Shape[Index], bHit);
+
+        if (bHit)
+        {
+            const FVector Dir = (Batch.End[Index] - Batch.Start[Index]).GetSafeNormal();
+            for (const FHitResult& H : SweepHits[Index])
+            {
+                FrameStats.Hits += Tracer->HandleHit(H, Dir) ? 1 : 0;
+            }
+        }
+    }
+}
+
+void UMeleeTraceSubsystem::ExecuteImmediate(UMeleeHitTracerComponent* Tracer, const FMeleeSweepBatch& InBatch)
+{
+    UWorld* World = GetWorld();
+    if (!World || !Tracer) return;
+
+    Tracer->CurrentHitTime = World->GetTimeSeconds();
+    for (int32 Index = 0; Index < InBatch.Num(); ++Index)
+    {
+        if (!Tracer->IsTracing()) break;
+
+        const int32 PrevCapacity = ImmediateHits.Max();
+        ImmediateHits.Reset();
+
+        const bool bHit = World->SweepMultiByChannel(
+            ImmediateHits, InBatch.Start[Index], InBatch.End[Index], InBatch.Rot[Index],
+            Tracer->TraceConfig.TraceChannel, InBatch.Shape[Index], Tracer->CachedQueryParams);
+
+        INC_DWORD_STAT(STAT_CombatSweeps);
+        ++FrameStats.Sweeps;
+        if (ImmediateHits.Max() > PrevCapacity)
+        {
+            INC_DWORD_STAT(STAT_CombatHitBufferAllocs);
+            ++FrameStats.HitBufferAllocs;
+        }
+
+        Tracer->DrawSweepDebug(InBatch.Start[Index], InBatch.End[Index], InBatch.Rot[Index], InBatch.Shape[Index], bHit);
+        if (bHit)
+        {
+            const FVector Dir = (InBatch.End[Index] - InBatch.Start[Index]).GetSafeNormal();
+            for (const FHitResult& H : ImmediateHits)
+            {
+                FrameStats.Hits += Tracer->HandleHit(H, Dir) ? 1 : 0;
+            }
+        }
+    }
+}
+
+void UMeleeTraceSubsystem::RunSweep(UWorld* World, int32 SweepIndex)
+{
+    const UMeleeHitTracerComponent* Tracer = FrameTracers[Batch.TracerIndex[SweepIndex]];
+    TArray<FHitResult>& Hits = SweepHits[SweepIndex];
+
+    if (Tracer->bUseAsyncTrace)
+    {
+        Hits.Reset();
+        SweepBlocked[SweepIndex] = 0;
+        return;
+    }
+
+    const int32 PrevCapacity = Hits.Max();
+    Hits.Reset(); // 용량 유지
+
+    SweepBlocked[SweepIndex] = World->SweepMultiByChannel(
+        Hits, Batch.Start[SweepIndex], Batch.End[SweepIndex], Batch.Rot[SweepIndex],
+        Tracer->TraceConfig.TraceChannel, Batch.Shape[SweepIndex], Tracer->CachedQueryParams) ? 1 : 0;
+
+    if (Hits.Max() > PrevCapacity)
+    {
+        // 병렬 실행 중일 수 있으므로 프레임 통계는 원자적으로
+        INC_DWORD_STAT(STAT_CombatHitBufferAllocs);
+        FPlatformAtomics::InterlockedIncrement(&FrameStats.HitBufferAllocs);
+    }
+}
+
+void UMeleeTraceSubsystem::SubmitAsyncSweep(UWorld* World, int32 SweepIndex)
+{
+    UMeleeHitTracerComponent* Tracer = FrameTracers[Batch.TracerIndex[SweepIndex]];
+
+    const int32 Slot = FreeAsyncSlots.Num() > 0 ? FreeAsyncSlots.Pop(false) : AsyncSlots.AddDefaulted();
+    FMeleeAsyncSweep& Pending = AsyncSlots[Slot];
+    Pending.Tracer = Tracer;
+    Pending.WindowId = Tracer->TraceWindowId;
+    Pending.SubmitTime = World->GetTimeSeconds();
+
+    World->AsyncSweepByChannel(
+        EAsyncTraceType::Multi, Batch.Start[SweepIndex], Batch.End[SweepIndex], Batch.Rot[SweepIndex],
+        Tracer->TraceConfig.TraceChannel, Batch.Shape[SweepIndex], Tracer->CachedQueryParams,
+        FCollisionResponseParams::DefaultResponseParam, &AsyncSweepDelegate, (uint32)Slot);
+}
+
+void UMeleeTraceSubsystem::OnAsyncSweepDone(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+    const int32 Slot = (int32)Datum.UserData;
+    if (!AsyncSlots.IsValidIndex(Slot)) return;
+
+    const FMeleeAsyncSweep Pending = AsyncSlots[Slot];
+    AsyncSlots[Slot] = FMeleeAsyncSweep();
+    FreeAsyncSlots.Add(Slot);
+
+    // 제출 후 창이 취소/재시작되었으면 폐기 (StopTrace(false)로 닫힌 창의 마지막 결과는 유지)
+    UMeleeHitTracerComponent* Tracer = Pending.Tracer.Get();
+    if (!IsValid(Tracer) || Tracer->TraceWindowId != Pending.WindowId) return;
+
+    // 동기 경로와 동일하게 블로킹 히트가 있을 때만 처리
+    const bool bHit = Datum.OutHits.ContainsByPredicate([](const FHitResult& H) { return H.bBlockingHit; });
+    Tracer->DrawSweepDebug(Datum.Start, Datum.End, Datum.Rot, Datum.CollisionParams.CollisionShape, bHit);
+    if (!bHit) return;
+
+    const UWorld* World = GetWorld();
+    Tracer->CurrentHitTime = (Tracer->bRewindAsyncHitTime || !World) ? Pending.SubmitTime : World->GetTimeSeconds();
+
+    const FVector Dir = (Datum.End - Datum.Start).GetSafeNormal();
+    for (const FHitResult& H : Datum.OutHits)
+    {
+        // 앞선 히트 콜백에서 창이 취소되었으면 중단
+        if (Tracer->TraceWindowId != Pending.WindowId) break;
+        FrameStats.Hits += Tracer->HandleHit(H, Dir) ? 1 : 0;
+    }
+}
+
+void UMeleeTraceSubsystem::StartBenchmark(int32 NumFrames, const FString& Name)
+{
+    BenchFramesRemaining = FMath::Max(1, NumFrames);
+    BenchName = Name;
+    BenchSamples.Reset(BenchFramesRemaining);
+}
+
+void UMeleeTraceSubsystem::FinishFrameStats(float DeltaTime)
+{
+    FrameStats.FrameMs = DeltaTime * 1000.f;
+    LastFrameStats = FrameStats;
+    FrameStats = FMeleeTraceFrameStats();
+
+    if (BenchFramesRemaining > 0)
+    {
+        BenchSamples.Add(LastFrameStats);
+        if (--BenchFramesRemaining == 0)
+        {
+            WriteBenchmark();
+            DestroyBenchActors();
+        }
+    }
+}
+
+void UMeleeTraceSubsystem::WriteBenchmark()
+{
+    FString Csv = TEXT("Frame,FrameMs,TraceMs,ActiveTracers,Sweeps,AsyncSweeps,Hits,HitBufferAllocs\n");
+    FMeleeTraceFrameStats Sum;
+    for (int32 i = 0; i < BenchSamples.Num(); ++i)
+    {
+        const FMeleeTraceFrameStats& F = BenchSamples[i];
+        Csv += FString::Printf(TEXT("%d,%.3f,%.3f,%d,%d,%d,%d,%d\n"),
+            i, F.FrameMs, F.TraceMs, F.ActiveTracers, F.Sweeps, F.AsyncSweeps, F.Hits, F.HitBufferAllocs);
+        Sum.FrameMs += F.FrameMs;
+        Sum.TraceMs += F.TraceMs;
+        Sum.Sweeps += F.Sweeps;
+        Sum.Hits += F.Hits;
+        Sum.HitBufferAllocs += F.HitBufferAllocs;
+    }
+
+    const FString Path = FPaths::ProfilingDir() / TEXT("MeleeBench") / (BenchName + TEXT(".csv"));
+    FFileHelper::SaveStringToFile(Csv, *Path);
+
+    const float N = (float)FMath::Max(1, BenchSamples.Num());
+    UE_LOG(LogTemp, Log, TEXT("MeleeBench %s: %d frames, avg frame %.3f ms, avg trace %.3f ms, %.1f sweeps/frame, %d hits, %d buffer allocs -> %s"),
+        *BenchName, BenchSamples.Num(), Sum.FrameMs / N, Sum.TraceMs / N, Sum.Sweeps / N, Sum.Hits, Sum.HitBufferAllocs, *Path);
+
+    BenchSamples.Empty();
+}
+
+void UMeleeTraceSubsystem::RunBenchmark(int32 NumAttackers, int32 NumDummies, int32 NumFrames, const FString& Name)
+{
+    UWorld* World = GetWorld();
+    if (!World) return;
+    DestroyBenchActors();
+
+    NumAttackers = FMath::Max(1, NumAttackers);
+    NumDummies = FMath::Max(0, NumDummies);
+    const int32 GridSize = FMath::CeilToInt(FMath::Sqrt((float)NumAttackers));
+
+    // 3타 콤보: 0 → 1 → 2 (RequestAttack을 매 프레임 넣으므로 버퍼로 계속 이어짐)
+    TArray<FMeleeAttackSpec> Combo;
+    for (int32 i = 0; i < 3; ++i)
+    {
+        FMeleeAttackSpec& Spec = Combo.AddDefaulted_GetRef();
+        Spec.Name = *FString::Printf(TEXT("Bench_%d"), i + 1);
+        Spec.NextIndex = (i < 2) ? i + 1 : INDEX_NONE;
+    }
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+    for (int32 i = 0; i < NumAttackers; ++i)
+    {
+        const FVector Loc = MeleeBench::Origin + FVector((i % GridSize) * MeleeBench::Spacing, (i / GridSize) * MeleeBench::Spacing, 0.f);
+        AActor* Attacker = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(Loc), SpawnParams);
+        if (!Attacker) continue;
+
+        USceneComponent* Root = NewObject<USceneComponent>(Attacker, TEXT("BenchRoot"));
+        Attacker->SetRootComponent(Root);
+        Root->RegisterComponent();
+
+        // 메시 에셋 없는 스켈레탈 컴포넌트: 소켓이 없으면 컴포넌트 위치를 쓰므로 회전하는 한 점을 스윕
+        USkeletalMeshComponent* Weapon = NewObject<USkeletalMeshComponent>(Attacker, TEXT("BenchWeapon"));
+        Weapon->SetupAttachment(Root);
+        Weapon->SetRelativeLocation(FVector(MeleeBench::BladeReach, 0.f, 0.f));
+        Weapon->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+        Weapon->RegisterComponent();
+
+        // 트레이서를 먼저 등록해야 공격 컴포넌트 BeginPlay가 찾음
+        UMeleeHitTracerComponent* Tracer = NewObject<UMeleeHitTracerComponent>(Attacker, TEXT("BenchTracer"));
+        Tracer->SetWeaponMesh(Weapon);
+        Tracer->RegisterComponent();
+
+        UMeeleAttackComponent* Attack = NewObject<UMeeleAttackComponent>(Attacker, TEXT("BenchAttack"));
+        Attack->AttackList = Combo;
+        Attack->RegisterComponent();
+
+        BenchActors.Add(Attacker);
+        BenchAttackers.Add(Attack);
+    }
+
+    // 더미: 공격자 주변 블레이드 궤적 위에 고르게 분배
+    for (int32 j = 0; j < NumDummies; ++j)
+    {
+        const int32 Owner = j % NumAttackers;
+        const int32 Slot = j / NumAttackers;
+        const float Angle = Slot * 137.5f; // 황금각: 같은 공격자 주변 더미가 겹치지 않게
+        const FVector Center = MeleeBench::Origin + FVector((Owner % GridSize) * MeleeBench::Spacing, (Owner / GridSize) * MeleeBench::Spacing, 0.f);
+        const FVector Loc = Center + FRotator(0.f, Angle, 0.f).Vector() * (MeleeBench::BladeReach + 30.f);
+
+        AActor* Dummy = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(Loc), SpawnParams);
+        if (!Dummy) continue;
+
+        UCapsuleComponent* Capsule = NewObject<UCapsuleComponent>(Dummy, TEXT("BenchCapsule"));
+        Capsule->InitCapsuleSize(34.f, 88.f);
+        Capsule->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+        Capsule->SetCollisionResponseToAllChannels(ECR_Block);
+        Dummy->SetRootComponent(Capsule);
+        Capsule->RegisterComponent();
+
+        BenchActors.Add(Dummy);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("MeleeBench %s: spawned %d attackers, %d dummies, recording %d frames"),
+        *Name, BenchAttackers.Num(), BenchActors.Num() - BenchAttackers.Num(), NumFrames);
+    StartBenchmark(NumFrames, Name);
+}
+
+void UMeleeTraceSubsystem::DriveBenchAttackers(float DeltaTime)
+{
+    const FRotator Spin(0.f, MeleeBench::SpinDegPerSec * DeltaTime, 0.f);
+    for (const TWeakObjectPtr<UMeeleAttackComponent>& Weak : BenchAttackers)
+    {
+        UMeeleAttackComponent* Attack = Weak.Get();
+        if (!Attack || !Attack->GetOwner()) continue;
+
+        // 블레이드를 돌려 매 프레임 실제 궤적을 만들고, 입력은 항상 넣어 콤보를 유지
+        Attack->GetOwner()->AddActorWorldRotation(Spin);
+        Attack->RequestAttack();
+    }
+}
+
+void UMeleeTraceSubsystem::DestroyBenchActors()
+{
+    for (const TWeakObjectPtr<AActor>& Weak : BenchActors)
+    {
+        if (AActor* Actor = Weak.Get())
+        {
+            Actor->Destroy();
+        }
+    }
+    BenchActors.Reset();
+    BenchAttackers.Reset();
+}
@@ -0,0 +1,168 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CollisionShape.h"
+#include "WorldCollision.h"
+#include "MeleePoseHistory.h"
+#include "MeleeTraceSubsystem.generated.h"
+
+class UMeleeHitTracerComponent;
+class UMeeleAttackComponent;
+
+// 결과 대기 중인 비동기 스윕 (FTraceDatum::UserData = 슬롯 인덱스)
+struct FMeleeAsyncSweep
+{
+    TWeakObjectPtr<UMeleeHitTracerComponent> Tracer;
+    uint32 WindowId = 0;
+    float SubmitTime = 0.f;
+};
+
+// 월드 단위 스윕 버퍼 (SoA). 모든 트레이서의 한 프레임 서브스텝이 연속으로 쌓인다.
+struct FMeleeSweepBatch
+{
+    TArray<FVector> Start;
+    TArray<FVector> End;
+    TArray<FQuat> Rot;
+    TArray<FCollisionShape> Shape;
+    TArray<int32> TracerIndex; // UMeleeTraceSubsystem::FrameTracers 인덱스
+
+    int32 Num() const { return Start.Num(); }
+
+    void Reset()
+    {
+        // 용량 유지 → 정상 상태에서 힙 할당 없음
+        Start.Reset();
+        End.Reset();
+        Rot.Reset();
+        Shape.Reset();
+        TracerIndex.Reset();
+    }
+
+    void BeginTracer(int32 InTracerIndex) { CurrentTracer = InTracerIndex; }
+
+    void Add(const FVector& InStart, const FVector& InEnd, const FQuat& InRot, const FCollisionShape& InShape)
+    {
+        Start.Add(InStart);
+        End.Add(InEnd);
+        Rot.Add(InRot);
+        Shape.Add(InShape);
+        TracerIndex.Add(CurrentTracer);
+    }
+
+private:
+    int32 CurrentTracer = INDEX_NONE;
+};
+
+// 프레임 단위 트레이스 통계 (벤치마크 기록/회귀 비교용)
+struct FMeleeTraceFrameStats
+{
+    int32 ActiveTracers = 0;
+    int32 Sweeps = 0;
+    int32 AsyncSweeps = 0;
+    int32 Hits = 0;
+    int32 HitBufferAllocs = 0;
+    float TraceMs = 0.f;  // 서브시스템 패스(수집/실행/디스패치) 게임 스레드 비용
+    float FrameMs = 0.f;  // 프레임 전체 DeltaTime
+};
+
+// 래그 보상 대상 액터와 그 포즈 히스토리
+struct FMeleeRewindTarget
+{
+    TWeakObjectPtr<AActor> Actor;
+    FMeleePoseHistory History;
+};
+
+namespace MeleeRewind
+{
+    // 과거 포즈 기준 월드 지점을 현재 포즈 기준 월드 지점으로 (Current * Past^-1).
+    // 검증 때 대상 액터를 옮기지 않고 현재 컴포넌트로 판정 → 오버랩/이동 콜백/트랜스폼 복제 없음
+    inline FVector MapToCurrent(const FTransform& Past, const FTransform& Current, const FVector& PastPoint)
+    {
+        return Current.TransformPosition(Past.InverseTransformPosition(PastPoint));
+    }
+}
+
+/**
+ * 활성 근접 트레이서를 모아 한 패스로 스윕하는 월드 서브시스템.
+ * 트레이서는 StartTrace/StopTrace에서 등록/해제만 하고 자체 틱은 돌지 않는다.
+ */
+UCLASS()
+class PROJECT_NAME_API UMeleeTraceSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+    void RegisterTracer(UMeleeHitTracerComponent* Tracer);
+    void UnregisterTracer(UMeleeHitTracerComponent* Tracer);
+
+    int32 GetNumActiveTracers() const { return ActiveTracers.Num(); }
+
+    // 벤치마크: 다음 NumFrames 프레임의 통계를 CSV로 기록 (Saved/Profiling/MeleeBench/<Name>.csv)
+    void StartBenchmark(int32 NumFrames, const FString& Name);
+
+    // 구동 벤치마크: 콤보 스펙을 가진 공격자 NumAttackers, 더미 NumDummies를 스폰해 매 프레임 RequestAttack → StartBenchmark로 기록, 끝나면 제거
+    void RunBenchmark(int32 NumAttackers, int32 NumDummies, int32 NumFrames, const FString& Name);
+    const FMeleeTraceFrameStats& GetLastFrameStats() const { return LastFrameStats; }
+
+    // 외부 스텝 트레이서용: 배치를 즉시 동기 실행하고 히트 디스패치
+    void ExecuteImmediate(UMeleeHitTracerComponent* Tracer, const FMeleeSweepBatch& InBatch);
+
+    // 래그 보상: 서버에서 포즈 히스토리를 기록할 대상
+    void RegisterRewindTarget(AActor* Actor);
+    void UnregisterRewindTarget(AActor* Actor);
+
+    // Time 시점의 대상 포즈 (히스토리 밖이면 false, 할당 없음)
+    bool SampleTargetPose(const AActor* Actor, float Time, FTransform& OutTransform, FBox& OutBounds) const;
+
+    // FTickableGameObject
+    virtual void Tick(float DeltaTime) override;
+    virtual bool IsTickable() const override { return ActiveTracers.Num() > 0 || RewindTargets.Num() > 0 || BenchFramesRemaining > 0; }
+    virtual TStatId GetStatId() const override;
+
+private:
+    // 등록된 트레이서 (순서 무관)
+    TArray<TWeakObjectPtr<UMeleeHitTracerComponent>> ActiveTracers;
+
+    // 프레임 스냅샷: 디스패치 중 등록/해제가 일어나도 배치 인덱스가 흔들리지 않도록
+    TArray<UMeleeHitTracerComponent*> FrameTracers;
+
+    FMeleeSweepBatch Batch;
+
+    // 현재 프레임 누적(비동기 콜백/즉시 실행 포함) → 다음 Tick 시작에 확정
+    FMeleeTraceFrameStats FrameStats;
+    FMeleeTraceFrameStats LastFrameStats;
+
+    int32 BenchFramesRemaining = 0;
+    FString BenchName;
+    TArray<FMeleeTraceFrameStats> BenchSamples;
+    void FinishFrameStats(float DeltaTime);
+    void WriteBenchmark();
+
+    // RunBenchmark가 스폰한 액터 (기록이 끝나면 파괴)
+    TArray<TWeakObjectPtr<UMeeleAttackComponent>> BenchAttackers;
+    TArray<TWeakObjectPtr<AActor>> BenchActors;
+    void DriveBenchAttackers(float DeltaTime);
+    void DestroyBenchActors();
+
+    TArray<FMeleeRewindTarget> RewindTargets;
+    void RecordRewindHistory(float Now);
+
+    // 스윕별 결과 버퍼 (재사용). 병렬 실행 시 인덱스별로만 쓰므로 경합 없음
+    TArray<TArray<FHitResult>> SweepHits;
+    TArray<uint8> SweepBlocked;
+    TArray<FHitResult> ImmediateHits;
+
+    // 비동기 스윕 슬롯 (프리 리스트 재사용)
+    TArray<FMeleeAsyncSweep> AsyncSlots;
+    TArray<int32> FreeAsyncSlots;
+    FTraceDelegate AsyncSweepDelegate;
+
+    void RunSweep(UWorld* World, int32 SweepIndex);
+    void SubmitAsyncSweep(UWorld* World, int32 SweepIndex);
+    void OnAsyncSweepDone(const FTraceHandle& Handle, FTraceDatum& Datum);
+};
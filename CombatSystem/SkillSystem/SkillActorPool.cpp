@@ -0,0 +1,246 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "SkillActorPool.h"
+#include "SkillPoolable.h"
+#include "CombatStats.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
+#include "TimerManager.h"
+#include "HAL/IConsoleManager.h"
+
+static FAutoConsoleCommandWithWorld CmdSkillPoolDump(
+    TEXT("Skill.Pool.Dump"),
+    TEXT("스킬 액터 풀의 클래스별 대기/사용 중/예약/히트/미스 출력"),
+    FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+    {
+        if (const USkillActorPool* Pool = World ? World->GetSubsystem<USkillActorPool>() : nullptr)
+        {
+            Pool->DumpStats();
+        }
+    }));
+
+void USkillActorPool::Prewarm(TSubclassOf<AActor> Class, int32 Count)
+{
+    UWorld* World = GetWorld();
+    if (!World || !Class || Count <= 0) return;
+
+    FClassPool& Pool = Pools.FindOrAdd(Class);
+    Pool.Stats.Reserved += Count;
+
+    // 복제 액터는 서버만 만든다 (클라이언트는 복제로 받음)
+    const AActor* CDO = Class->GetDefaultObject<AActor>();
+    if (CDO->GetIsReplicated() && World->GetNetMode() == NM_Client) return;
+
+    const int32 ToSpawn = Pool.Stats.Reserved - (Pool.Stats.Free + Pool.Stats.InUse);
+    for (int32 i = 0; i < ToSpawn; ++i)
+    {
+        AActor* Actor = SpawnPooled(Class, FTransform::Identity, nullptr, nullptr, /*bActive*/ false);
+        if (!Actor) break;
+
+        Owned[Actor].bFree = true;
+        Pool.Free.Add(Actor);
+        ++Pool.Stats.Free;
+    }
+}
+
+void USkillActorPool::Unreserve(TSubclassOf<AActor> Class, int32 Count)
+{
+    if (FClassPool* Pool = Pools.Find(Class))
+    {
+        Pool->Stats.Reserved = FMath::Max(0, Pool->Stats.Reserved - Count);
+    }
+}
+
+AActor* USkillActorPool::Acquire(TSubclassOf<AActor> Class, const FTransform& Transform, AActor* Owner, APawn* Instigator, bool& bOutFromPool)
+{
+    bOutFromPool = false;
+    if (!GetWorld() || !Class) return nullptr;
+
+    FClassPool& Pool = Pools.FindOrAdd(Class);
+    while (Pool.Free.Num() > 0)
+    {
+        AActor* Actor = Pool.Free.Pop(/*bAllowShrinking*/ false).Get();
+        --Pool.Stats.Free;
+        if (!IsValid(Actor)) continue;
+
+        Actor->SetOwner(Owner);
+        Actor->SetInstigator(Instigator);
+        Actor->SetActorTransform(Transform, /*bSweep*/ false, nullptr, ETeleportType::ResetPhysics);
+        SetPooledActive(Actor, true);
+
+        FPooledEntry& Entry = Owned.FindChecked(Actor);
+        Entry.bFree = false;
+        StartLifeSpan(Actor, Entry);
+
+        ++Pool.Stats.InUse;
+        ++Pool.Stats.Hits;
+        INC_DWORD_STAT(STAT_CombatSkillPoolHits);
+        bOutFromPool = true;
+        return Actor;
+    }
+
+    AActor* Actor = SpawnPooled(Class, Transform, Owner, Instigator, /*bActive*/ true);
+    if (Actor)
+    {
+        StartLifeSpan(Actor, Owned.FindChecked(Actor));
+        ++Pool.Stats.InUse;
+        ++Pool.Stats.Misses;
+        INC_DWORD_STAT(STAT_CombatSkillPoolMisses);
+    }
+    return Actor;
+}
+
+bool USkillActorPool::Release(AActor* Actor)
+{
+    if (!IsValid(Actor)) return false;
+
+    FPooledEntry* Entry = Owned.Find(Actor);
+    FClassPool* Pool = Entry ? Pools.Find(Entry->Class) : nullptr;
+    if (!Pool) return false;
+
+    // 이미 대기 중이면 중복 반납 무시
+    if (Entry->bFree) return true;
+    Entry->bFree = true;
+    GetWorld()->GetTimerManager().ClearTimer(Entry->ExpireTimer);
+
+    if (Actor->Implements<USkillPoolable>())
+    {
+        ISkillPoolable::Execute_OnSkillReleased(Actor);
+    }
+
+    Actor->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+    SetPooledActive(Actor, false);
+
+    Pool->Free.Add(Actor);
+    ++Pool->Stats.Free;
+    --Pool->Stats.InUse;
+    return true;
+}
+
+void USkillActorPool::ReleaseSkillActor(AActor* Actor)
+{
+    if (!IsValid(Actor)) return;
+
+    UWorld* World = Actor->GetWorld();
+    USkillActorPool* Pool = World ? World->GetSubsystem<USkillActorPool>() : nullptr;
+    if (!Pool || !Pool->Release(Actor))
+    {
+        Actor->Destroy();
+    }
+}
+
+FSkillPoolStats USkillActorPool::GetPoolStats(TSubclassOf<AActor> Class) const
+{
+    const FClassPool* Pool = Pools.Find(Class);
+    return Pool ? Pool->Stats : FSkillPoolStats();
+}
+
+void USkillActorPool::DumpStats() const
+{
+    for (const TPair<TSubclassOf<AActor>, FClassPool>& Pair : Pools)
+    {
+        const FSkillPoolStats& S = Pair.Value.Stats;
+        const int32 Requests = S.Hits + S.Misses;
+        UE_LOG(LogTemp, Log, TEXT("SkillPool %s: free %d, in use %d, reserved %d, hits %d, misses %d (%.1f%% hit)"),
+            *GetNameSafe(Pair.Key), S.Free, S.InUse, S.Reserved, S.Hits, S.Misses,
+            Requests > 0 ? 100.f * S.Hits / Requests : 0.f);
+    }
+}
+
+void USkillActorPool::Deinitialize()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearAllTimersForObject(this);
+    }
+    Pools.Empty();
+    Owned.Empty();
+    Super::Deinitialize();
+}
+
+AActor* USkillActorPool::SpawnPooled(TSubclassOf<AActor> Class, const FTransform& Transform, AActor* Owner, APawn* Instigator, bool bActive)
+{
+    AActor* Actor = GetWorld()->SpawnActorDeferred<AActor>(Class, Transform, Owner, Instigator,
+        ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn);
+    if (!Actor) return nullptr;
+
+    // 엔진 수명은 만료 시 Destroy하므로 끔 (BeginPlay가 InitialLifeSpan으로 수명을 건다). 수명은 풀 타이머가 관리
+    Actor->InitialLifeSpan = 0.f;
+    if (!bActive)
+    {
+        // BeginPlay 전에 대기 상태로: 충돌/표시 OFF
+        SetPooledActive(Actor, false);
+    }
+    Actor->FinishSpawning(Transform);
+    if (!IsValid(Actor)) return nullptr;
+
+    if (!bActive)
+    {
+        // 틱 함수는 BeginPlay에서 등록되며 bStartWithTickEnabled로 다시 켜지므로 한 번 더 정지
+        SetPooledActive(Actor, false);
+    }
+
+    INC_DWORD_STAT(STAT_CombatSkillSpawns);
+    Owned.Add(Actor).Class = Class;
+    Actor->OnDestroyed.AddDynamic(this, &USkillActorPool::OnPooledActorDestroyed);
+    return Actor;
+}
+
+void USkillActorPool::SetPooledActive(AActor* Actor, bool bActive)
+{
+    Actor->SetActorHiddenInGame(!bActive);
+    Actor->SetActorEnableCollision(bActive);
+    Actor->SetActorTickEnabled(bActive && Actor->PrimaryActorTick.bStartWithTickEnabled);
+
+    // 이동/파티클 등 컴포넌트 틱도 정지 → 대기 중 비용 0
+    Actor->ForEachComponent<UActorComponent>(false, [bActive](UActorComponent* Comp)
+    {
+        if (Comp->PrimaryComponentTick.bCanEverTick)
+        {
+            Comp->SetComponentTickEnabled(bActive && Comp->PrimaryComponentTick.bStartWithTickEnabled);
+        }
+    });
+}
+
+void USkillActorPool::StartLifeSpan(AActor* Actor, FPooledEntry& Entry)
+{
+    const float LifeSpan = Entry.Class->GetDefaultObject<AActor>()->InitialLifeSpan;
+    if (LifeSpan <= 0.f) return;
+
+    GetWorld()->GetTimerManager().SetTimer(Entry.ExpireTimer,
+        FTimerDelegate::CreateUObject(this, &USkillActorPool::OnPooledLifeSpanExpired, TWeakObjectPtr<AActor>(Actor)),
+        LifeSpan, false);
+}
+
+void USkillActorPool::OnPooledLifeSpanExpired(TWeakObjectPtr<AActor> Actor)
+{
+    if (AActor* Expired = Actor.Get())
+    {
+        Release(Expired);
+    }
+}
+
+void USkillActorPool::OnPooledActorDestroyed(AActor* Actor)
+{
+    FPooledEntry Entry;
+    if (!Owned.RemoveAndCopyValue(Actor, Entry)) return;
+
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(Entry.ExpireTimer);
+    }
+    if (FClassPool* Pool = Pools.Find(Entry.Class))
+    {
+        if (Entry.bFree)
+        {
+            Pool->Free.RemoveSingleSwap(Actor);
+            --Pool->Stats.Free;
+        }
+        else
+        {
+            --Pool->Stats.InUse;
+        }
+    }
+}
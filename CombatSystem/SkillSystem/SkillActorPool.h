@@ -0,0 +1,103 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineTypes.h"
+#include "SkillActorPool.generated.h"
+
+/** 클래스별 풀 상태/통계 */
+USTRUCT(BlueprintType)
+struct FSkillPoolStats
+{
+    GENERATED_BODY()
+
+    /** 대기 중(비활성) 액터 수 */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Skill|Pool")
+    int32 Free = 0;
+
+    /** 사용 중 액터 수 */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Skill|Pool")
+    int32 InUse = 0;
+
+    /** 프리웜 목표(컴포넌트들이 예약한 합) */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Skill|Pool")
+    int32 Reserved = 0;
+
+    /** 풀에서 바로 꺼낸 횟수 */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Skill|Pool")
+    int32 Hits = 0;
+
+    /** 대기 액터가 없어 새로 스폰한 횟수 */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Skill|Pool")
+    int32 Misses = 0;
+};
+
+/**
+ * 스킬 오브젝트 클래스별 액터 풀 (월드 단위, 모든 SkillComponent가 공유).
+ * 반납된 액터는 숨김/충돌 해제/틱 정지 상태로 남아 다음 Acquire에서 재사용된다.
+ * 풀 액터의 엔진 수명은 항상 0이고, 클래스 기본 InitialLifeSpan은 풀 타이머가 대신 재서 만료 시 Release한다.
+ */
+UCLASS()
+class DUSKREGION_API USkillActorPool : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Count만큼 예약하고, 풀 크기(대기+사용 중)가 예약 합에 못 미치면 미리 스폰 */
+    void Prewarm(TSubclassOf<AActor> Class, int32 Count);
+
+    /** Prewarm 예약 해제 (이미 만든 액터는 유지) */
+    void Unreserve(TSubclassOf<AActor> Class, int32 Count);
+
+    /** 대기 액터를 꺼내 배치. 없으면 스폰(미스). bOutFromPool = 풀 히트 여부 */
+    AActor* Acquire(TSubclassOf<AActor> Class, const FTransform& Transform, AActor* Owner, APawn* Instigator, bool& bOutFromPool);
+
+    /** 풀로 반납. 풀 소속이 아니면 false (호출자가 Destroy) */
+    bool Release(AActor* Actor);
+
+    /** 액터를 풀로 반납하고, 풀이 없거나 풀 소속이 아니면 파괴. 스킬 액터의 Destroy 대신 사용 */
+    UFUNCTION(BlueprintCallable, Category = "Skill|Pool", meta = (DefaultToSelf = "Actor"))
+    static void ReleaseSkillActor(AActor* Actor);
+
+    UFUNCTION(BlueprintCallable, Category = "Skill|Pool")
+    FSkillPoolStats GetPoolStats(TSubclassOf<AActor> Class) const;
+
+    /** 모든 클래스의 풀 상태를 로그로 출력 (Skill.Pool.Dump) */
+    void DumpStats() const;
+
+    virtual void Deinitialize() override;
+
+private:
+    struct FClassPool
+    {
+        TArray<TWeakObjectPtr<AActor>> Free;
+        FSkillPoolStats Stats;
+    };
+
+    /** 풀 소속 액터 하나의 장부 */
+    struct FPooledEntry
+    {
+        TSubclassOf<AActor> Class;
+        FTimerHandle ExpireTimer; // 사용 중 수명 (클래스 기본 InitialLifeSpan)
+        bool bFree = false;       // 대기 목록에 있는지 (중복 반납 판정)
+    };
+
+    TMap<TSubclassOf<AActor>, FClassPool> Pools;
+
+    /** 풀에서 관리 중인(대기+사용 중) 액터 → 장부 */
+    TMap<TWeakObjectPtr<AActor>, FPooledEntry> Owned;
+
+    /** 지연 스폰. 엔진 수명은 항상 0. bActive = false면 FinishSpawning 전에 대기 상태로 만들어 BeginPlay부터 비활성 */
+    AActor* SpawnPooled(TSubclassOf<AActor> Class, const FTransform& Transform, AActor* Owner, APawn* Instigator, bool bActive);
+    static void SetPooledActive(AActor* Actor, bool bActive);
+
+    /** 꺼낸 액터에 클래스 기본 수명만큼 풀 타이머를 건다 (만료 시 Destroy 대신 Release) */
+    void StartLifeSpan(AActor* Actor, FPooledEntry& Entry);
+    void OnPooledLifeSpanExpired(TWeakObjectPtr<AActor> Actor);
+
+    /** 풀 액터가 외부에서 파괴된 경우(레벨 언로드 등) 장부 정리 */
+    UFUNCTION()
+    void OnPooledActorDestroyed(AActor* Actor);
+};
@@ -6,17 +6,149 @@
 #include "GameFramework/Controller.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "BaseCharacter.h"
+#include "CombatStats.h"
+#include "SkillActorPool.h"
+#include "SkillPoolable.h"
 #include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/Pawn.h"
+#include "Net/UnrealNetwork.h"
+#include "TimerManager.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarSkillBatchParallelMin(
+    TEXT("Skill.Batch.ParallelMinRequests"),
+    64,
+    TEXT("배치 활성화 요청 수가 이 값 이상이면 스폰 트랜스폼을 ParallelFor로 계산 (0 = 항상 게임 스레드)"));
+
+bool FSkillNetRequest::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    Ar.SerializeBits(&Slot, SkillNet::SlotBits);
+    Ar << InputSeq;
+    Ar << ClientTimeMs;
+    Ar.SerializeBits(&AimYaw, CombatNet::YawBits);
+    Ar.SerializeBits(&AimPitch, CombatNet::PitchBits);
+
+    uint8 bTarget = bHasTarget ? 1 : 0;
+    Ar.SerializeBits(&bTarget, 1);
+    bHasTarget = bTarget != 0;
+
+    bOutSuccess = true;
+    if (bHasTarget)
+    {
+        TargetLocation.NetSerialize(Ar, Map, bOutSuccess);
+    }
+
+    uint32 PackedMeta = (uint32)Meta;
+    Ar.SerializeIntPacked(PackedMeta);
+    Meta = (int32)PackedMeta;
+    return true;
+}
+
+bool FSkillCooldownRepState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    Ar.SerializeBits(&ActiveMask, FSkillSlotIndex::Num);
+    for (int32 i = 0; i < FSkillSlotIndex::Num; ++i)
+    {
+        if (ActiveMask & (1 << i))
+        {
+            Ar << EndCs[i];
+            Ar.SerializeBits(&Charges[i], SkillNet::ChargeBits);
+        }
+    }
+    bOutSuccess = true;
+    return true;
+}
 
 SkillComponent::SkillComponent()
 {
     PrimaryComponentTick.bCanEverTick = true;
+    // 쿨다운은 USkillCooldownWheel이 구동 → 기본적으로 틱 불필요
+    PrimaryComponentTick.bStartWithTickEnabled = false;
+    SetIsReplicatedByDefault(true);
+}
+
+void SkillComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+    // 쿨다운은 소유 클라이언트 UI/예측 보정용
+    DOREPLIFETIME_CONDITION(SkillComponent, CooldownState, COND_OwnerOnly);
 }
 
 void SkillComponent::BeginPlay()
 {
     Super::BeginPlay();
     OwnerCharacter = Cast<ABaseCharacter>(GetOwner());
+
+    for (int32 i = 0; i < FSkillSlotIndex::Num; ++i)
+    {
+        SlotRuntime.Items[i].Charges = SlotTable[i].MaxCharges;
+    }
+
+    // 슬롯 설정 기준으로 스킬 액터 풀 프리웜 → 전투 중 스폰 비용 0
+    if (USkillActorPool* Pool = GetWorld() ? GetWorld()->GetSubsystem<USkillActorPool>() : nullptr)
+    {
+        // 예측 코스메틱은 소유 클라이언트에서만 쓰임 (시뮬레이티드 프록시/서버는 예약 안 함)
+        bCosmeticsReserved = GetNetMode() == NM_Client && GetOwnerRole() != ROLE_SimulatedProxy;
+        for (const FSkillSlotConfig& Cfg : SlotTable)
+        {
+            Pool->Prewarm(Cfg.SkillObjectClass, Cfg.PoolPrewarmCount);
+            if (bCosmeticsReserved)
+            {
+                Pool->Prewarm(Cfg.PredictedCosmeticClass, Cfg.PoolPrewarmCount);
+            }
+        }
+    }
+}
+
+void SkillComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(PredictionTimer);
+    }
+    if (USkillCooldownWheel* Wheel = GetCooldownWheel())
+    {
+        for (FSkillSlotRuntime& Rt : SlotRuntime)
+        {
+            Wheel->Cancel(Rt.RechargeTimer);
+        }
+    }
+    for (const FPredictedSkill& P : PendingPredictions)
+    {
+        USkillActorPool::ReleaseSkillActor(P.Cosmetic.Get());
+    }
+    PendingPredictions.Reset();
+
+    if (USkillActorPool* Pool = GetWorld() ? GetWorld()->GetSubsystem<USkillActorPool>() : nullptr)
+    {
+        for (const FSkillSlotConfig& Cfg : SlotTable)
+        {
+            Pool->Unreserve(Cfg.SkillObjectClass, Cfg.PoolPrewarmCount);
+            if (bCosmeticsReserved)
+            {
+                Pool->Unreserve(Cfg.PredictedCosmeticClass, Cfg.PoolPrewarmCount);
+            }
+        }
+        bCosmeticsReserved = false;
+    }
+    Super::EndPlay(EndPlayReason);
+}
+
+void SkillComponent::PostLoad()
+{
+    Super::PostLoad();
+
+    // 구버전(TMap) 데이터 → 고정 슬롯 테이블
+    for (const TPair<ESkillSlot, FSkillSlotConfig>& Pair : SlotConfigs)
+    {
+        if (FSkillSlotIndex::IsValid(Pair.Key))
+        {
+            SlotTable[FSkillSlotIndex::ToIndex(Pair.Key)] = Pair.Value;
+        }
+    }
+    SlotConfigs.Empty();
 }
 
 void SkillComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -24,21 +156,16 @@ void SkillComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorC
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 }
 
-const FSkillSlotConfig* SkillComponent::GetConfig(ESkillSlot Slot) const
+FSkillSlotConfig SkillComponent::GetSlotConfig(ESkillSlot Slot) const
 {
-    return SlotConfigs.Find(Slot);
+    const FSkillSlotConfig* Cfg = GetConfig(Slot);
+    return Cfg ? *Cfg : FSkillSlotConfig();
 }
 
-FSkillSlotRuntime& SkillComponent::GetOrCreateRuntime(ESkillSlot Slot)
+FSkillSlotRuntime SkillComponent::GetSlotRuntime(ESkillSlot Slot) const
 {
-    FSkillSlotRuntime* Found = SlotRuntime.Find(Slot);
-    if (!Found)
-    {
-        FSkillSlotRuntime NewRt;
-        SlotRuntime.Add(Slot, NewRt);
-        Found = SlotRuntime.Find(Slot);
-    }
-    return *Found;
+    const FSkillSlotRuntime* Rt = GetRuntime(Slot);
+    return Rt ? *Rt : FSkillSlotRuntime();
 }
 
 bool SkillComponent::CanActivate(ESkillSlot Slot) const
@@ -48,10 +175,7 @@ bool SkillComponent::CanActivate(ESkillSlot Slot) const
     const FSkillSlotConfig* Cfg = GetConfig(Slot);
     if (!Cfg || !Cfg->SkillObjectClass) return false;
 
-    const FSkillSlotRuntime* Rt = SlotRuntime.Find(Slot);
-    const float Now = GetWorldTime();
-    const float Last = Rt ? Rt->LastActivatedTime : -FLT_MAX;
-    if (Now - Last < Cfg->CooldownSeconds) return false;
+    if (SlotRuntime[Slot].Charges <= 0) return false;
 
     // 리소스 체크는 ConsumeResource에서 수행(여기서는 true로 가정)
     return true;
@@ -59,80 +183,556 @@ bool SkillComponent::CanActivate(ESkillSlot Slot) const
 
 ESkillActivateResult SkillComponent::ActivateSkill(ESkillSlot Slot, const FSkillSpawnParams& Params, AActor*& OutSpawned)
 {
+    COMBAT_SCOPE(STAT_CombatSkillActivate);
     OutSpawned = nullptr;
     if (!GetWorld()) return ESkillActivateResult::NoWorld;
 
     const FSkillSlotConfig* Cfg = GetConfig(Slot);
     if (!Cfg || !Cfg->SkillObjectClass) return ESkillActivateResult::InvalidClass;
 
-    FSkillSlotRuntime& Rt = GetOrCreateRuntime(Slot);
+    // 소유 클라이언트는 왕복을 기다리지 않고 예측, 서버/스탠드얼론은 바로 실행
+    return IsPredictingClient()
+        ? ActivatePredicted(Slot, *Cfg, Params, OutSpawned)
+        : ActivateAuthoritative(Slot, *Cfg, Params, 0.f, OutSpawned);
+}
 
-    const float Now = GetWorldTime();
-    if (Now - Rt.LastActivatedTime < Cfg->CooldownSeconds)
+ESkillActivateResult SkillComponent::ActivateAuthoritative(ESkillSlot Slot, const FSkillSlotConfig& Config, const FSkillSpawnParams& Params, float LatencyCompensation, AActor*& OutSpawned)
+{
+    const ESkillActivateResult Check = ValidateActivation(Slot, Config, LatencyCompensation);
+    if (Check != ESkillActivateResult::Success) return Check;
+
+    // 클라이언트가 실제로 누른 시각 기준으로 재충전 시작
+    ConsumeCharge(Slot, Config, GetWorldTime() - LatencyCompensation, LatencyCompensation);
+
+    const FTransform SpawnXf = ComputeSpawnTransform(Slot, Config, Params);
+    OutSpawned = FinishActivation(Slot, Config, Params, SpawnXf);
+    if (!OutSpawned)
+    {
+        RefundCharge(Slot, Config);
+        return ESkillActivateResult::InvalidClass;
+    }
+    return ESkillActivateResult::Success;
+}
+
+ESkillActivateResult SkillComponent::ValidateActivation(ESkillSlot Slot, const FSkillSlotConfig& Config, float LatencyCompensation)
+{
+    // 충전이 없어도 지연 보상 안에 찰 예정이면 허용
+    const FSkillSlotRuntime& Rt = SlotRuntime[Slot];
+    const bool bHasCharge = Rt.Charges > 0 || (Rt.IsRecharging() && Rt.RechargeEndTime - GetWorldTime() <= LatencyCompensation);
+    if (!bHasCharge)
         return ESkillActivateResult::OnCooldown;
 
-    if (!ConsumeResource(Slot, *Cfg))
+    if (!ConsumeResource(Slot, Config))
         return ESkillActivateResult::NotEnoughResource;
 
-    FTransform SpawnXf = BuildSpawnTransform(Slot, Params);
+    return ESkillActivateResult::Success;
+}
+
+FTransform SkillComponent::ComputeSpawnTransform(ESkillSlot Slot, const FSkillSlotConfig& Config, const FSkillSpawnParams& Params) const
+{
+    FTransform SpawnXf = BuildSpawnTransform(Config, Params);
     PreBuildSpawnTransform(Slot, Params, SpawnXf);
+    return SpawnXf;
+}
 
-    OutSpawned = SpawnSkillAt(Slot, SpawnXf, Params);
-    if (OutSpawned)
+AActor* SkillComponent::FinishActivation(ESkillSlot Slot, const FSkillSlotConfig& Config, const FSkillSpawnParams& Params, const FTransform& SpawnTransform)
+{
+    AActor* Spawned = SpawnSkillWithConfig(Slot, Config, SpawnTransform, Params);
+    if (!Spawned) return nullptr;
+
+    if (Config.bAttachToOwner && OwnerCharacter)
     {
-        Rt.LastActivatedTime = Now;
+        Spawned->AttachToActor(OwnerCharacter, FAttachmentTransformRules::KeepWorldTransform);
+    }
+
+    COMBAT_TRACE_EVENT(TEXT("SkillActivate %s %s %s"), *GetNameSafe(GetOwner()), *UEnum::GetValueAsString(Slot), *GetNameSafe(Spawned));
+    OnSkillSpawned.Broadcast(Slot, Spawned);
+    return Spawned;
+}
+
+void SkillComponent::ActivateSkillBatch(const TArray<FSkillBatchRequest>& Requests, TArray<FSkillBatchResult>& OutResults)
+{
+    COMBAT_SCOPE(STAT_CombatSkillActivateBatch);
+
+    OutResults.Reset(Requests.Num());
+    OutResults.SetNum(Requests.Num());
+
+    struct FAccepted
+    {
+        int32 RequestIndex;
+        const FSkillSlotConfig* Config;
+        FSpawnBasis Basis;
+        FTransform SpawnTransform;
+    };
+    TArray<FAccepted> Accepted;
+    Accepted.Reserve(Requests.Num());
+
+    // 1) 검증: 설정 해석/쿨다운/자원을 한 패스로 (게임 스레드)
+    for (int32 i = 0; i < Requests.Num(); ++i)
+    {
+        const FSkillBatchRequest& Req = Requests[i];
+        FSkillBatchResult& Out = OutResults[i];
+
+        SkillComponent* Comp = Req.Component;
+        if (!IsValid(Comp) || !Comp->GetWorld())
+        {
+            Out.Result = ESkillActivateResult::NoWorld;
+            continue;
+        }
+
+        const FSkillSlotConfig* Cfg = Comp->GetConfig(Req.Slot);
+        if (!Cfg || !Cfg->SkillObjectClass)
+        {
+            Out.Result = ESkillActivateResult::InvalidClass;
+            continue;
+        }
+
+        // 예측 클라이언트는 RPC 경로가 필요하므로 단건 처리
+        if (Comp->IsPredictingClient())
+        {
+            Out.Result = Comp->ActivatePredicted(Req.Slot, *Cfg, Req.Params, Out.Spawned);
+            continue;
+        }
 
-        if (Cfg->bAttachToOwner && OwnerCharacter)
+        Out.Result = Comp->ValidateActivation(Req.Slot, *Cfg, 0.f);
+        if (Out.Result == ESkillActivateResult::Success)
+        {
+            // 충전을 바로 소모 → 같은 배치 안의 같은 슬롯 중복 요청은 충전 부족으로 걸러짐 (스폰 실패 시 반환)
+            Comp->ConsumeCharge(Req.Slot, *Cfg, Comp->GetWorldTime());
+            Accepted.Add({ i, Cfg, FSpawnBasis(), FTransform::Identity });
+        }
+    }
+
+    // 2) 스폰 트랜스폼: 소켓/컨트롤 회전 읽기는 게임 스레드에서 모으고, 오프셋/회전 계산만 많으면 병렬
+    for (FAccepted& A : Accepted)
+    {
+        A.Basis = Requests[A.RequestIndex].Component->GatherSpawnBasis(*A.Config);
+    }
+
+    const int32 ParallelMin = CVarSkillBatchParallelMin.GetValueOnGameThread();
+    auto ComposeOne = [&Requests, &Accepted](int32 k)
+    {
+        FAccepted& A = Accepted[k];
+        A.SpawnTransform = ComposeSpawnTransform(*A.Config, Requests[A.RequestIndex].Params, A.Basis);
+    };
+    if (ParallelMin > 0 && Accepted.Num() >= ParallelMin)
+    {
+        ParallelFor(Accepted.Num(), ComposeOne);
+    }
+    else
+    {
+        for (int32 k = 0; k < Accepted.Num(); ++k) ComposeOne(k);
+    }
+
+    // 가상 훅은 병렬 구간이 끝난 뒤 게임 스레드에서
+    for (FAccepted& A : Accepted)
+    {
+        const FSkillBatchRequest& Req = Requests[A.RequestIndex];
+        Req.Component->PreBuildSpawnTransform(Req.Slot, Req.Params, A.SpawnTransform);
+    }
+
+    // 3) 스폰: 클래스별로 묶어 같은 풀을 연속으로 소진 (게임 스레드)
+    Accepted.StableSort([](const FAccepted& A, const FAccepted& B) { return A.Config->SkillObjectClass.Get() < B.Config->SkillObjectClass.Get(); });
+    for (const FAccepted& A : Accepted)
+    {
+        const FSkillBatchRequest& Req = Requests[A.RequestIndex];
+        FSkillBatchResult& Out = OutResults[A.RequestIndex];
+
+        Out.Spawned = Req.Component->FinishActivation(Req.Slot, *A.Config, Req.Params, A.SpawnTransform);
+        Out.Result = Out.Spawned ? ESkillActivateResult::Success : ESkillActivateResult::InvalidClass;
+        if (!Out.Spawned)
+        {
+            Req.Component->RefundCharge(Req.Slot, *A.Config);
+        }
+    }
+}
+
+ESkillActivateResult SkillComponent::ActivatePredicted(ESkillSlot Slot, const FSkillSlotConfig& Config, const FSkillSpawnParams& Params, AActor*& OutSpawned)
+{
+    const float Now = GetWorldTime();
+    if (SlotRuntime[Slot].Charges <= 0)
+        return ESkillActivateResult::OnCooldown;
+
+    // 자원은 서버 권위. 클라이언트는 충전/쿨다운과 연출만 예측
+    FTransform SpawnXf = BuildSpawnTransform(Config, Params);
+    PreBuildSpawnTransform(Slot, Params, SpawnXf);
+
+    // (슬롯, 조준 방향, 타깃, 타임스탬프)만 전송
+    FSkillNetRequest Request;
+    Request.Slot = (uint8)FSkillSlotIndex::ToIndex(Slot);
+    Request.InputSeq = ++LocalInputSeq;
+    Request.ClientTimeMs = CombatNet::QuantizeTime(GetNetTime());
+    CombatNet::QuantizeDirection(SpawnXf.GetRotation().Vector(), Request.AimYaw, Request.AimPitch);
+    Request.bHasTarget = !Params.TargetLocation.IsZero();
+    Request.TargetLocation = Params.TargetLocation;
+    Request.Meta = Params.Meta;
+    ServerActivateSkill(Request);
+
+    FPredictedSkill& Pending = PendingPredictions.AddDefaulted_GetRef();
+    Pending.InputSeq = Request.InputSeq;
+    Pending.Slot = Slot;
+    Pending.ExpireTime = Now + PredictedCosmeticTimeout;
+    ConsumeCharge(Slot, Config, Now);
+
+    if (Config.PredictedCosmeticClass)
+    {
+        OutSpawned = AcquireSkillActor(Config.PredictedCosmeticClass, Slot, SpawnXf, Params);
+        if (OutSpawned && Config.bAttachToOwner && OwnerCharacter)
         {
             OutSpawned->AttachToActor(OwnerCharacter, FAttachmentTransformRules::KeepWorldTransform);
         }
+        Pending.Cosmetic = OutSpawned;
+    }
+
+    GetWorld()->GetTimerManager().SetTimer(PredictionTimer, this, &SkillComponent::ExpirePredictions, FMath::Max(PredictedCosmeticTimeout, 0.01f), false);
 
+    if (OutSpawned)
+    {
         OnSkillSpawned.Broadcast(Slot, OutSpawned);
-        return ESkillActivateResult::Success;
     }
+    return ESkillActivateResult::Success;
+}
+
+void SkillComponent::ServerActivateSkill_Implementation(FSkillNetRequest Request)
+{
+    const ESkillSlot Slot = FSkillSlotIndex::FromIndex(Request.Slot);
+    const FSkillSlotConfig* Cfg = GetConfig(Slot);
+
+    const float Now = GetNetTime();
+    const float ClientTime = CombatNet::DequantizeTime(Request.ClientTimeMs, Now);
+    const float Latency = FMath::Clamp(Now - ClientTime, 0.f, MaxLatencyCompensation);
+
+    // 위치는 서버 소켓 기준, 조준만 클라이언트 값 사용
+    FSkillSpawnParams Params;
+    Params.Direction = CombatNet::DequantizeDirection(Request.AimYaw, Request.AimPitch);
+    Params.TargetLocation = Request.bHasTarget ? FVector(Request.TargetLocation) : FVector::ZeroVector;
+    Params.Meta = Request.Meta;
+
+    AActor* Spawned = nullptr;
+    const ESkillActivateResult Result = (Cfg && Cfg->SkillObjectClass)
+        ? ActivateAuthoritative(Slot, *Cfg, Params, Latency, Spawned)
+        : ESkillActivateResult::InvalidClass;
+
+    if (Result == ESkillActivateResult::Success)
+    {
+        ClientConfirmSkill(Request.InputSeq, Spawned);
+    }
+    else
+    {
+        ClientRejectSkill(Request.InputSeq);
+    }
+}
+
+void SkillComponent::ClientRejectSkill_Implementation(uint8 InputSeq)
+{
+    ResolvePrediction(InputSeq, /*bRejected*/ true);
+}
+
+void SkillComponent::ClientConfirmSkill_Implementation(uint8 InputSeq, AActor* Authoritative)
+{
+    // 서버 액터가 이미 보이면 코스메틱을 바로 교체, 아니면 타임아웃까지 유지
+    if (IsValid(Authoritative))
+    {
+        ResolvePrediction(InputSeq, /*bRejected*/ false);
+    }
+}
+
+void SkillComponent::ResolvePrediction(uint8 InputSeq, bool bRejected)
+{
+    const int32 Index = PendingPredictions.IndexOfByPredicate([InputSeq](const FPredictedSkill& P) { return P.InputSeq == InputSeq; });
+    if (Index == INDEX_NONE) return;
+
+    const FPredictedSkill Pending = PendingPredictions[Index];
+    PendingPredictions.RemoveAt(Index, 1, /*bAllowShrinking*/ false);
+
+    USkillActorPool::ReleaseSkillActor(Pending.Cosmetic.Get());
+
+    // 거부: 이 입력이 쓴 충전 반환
+    const FSkillSlotConfig* Cfg = GetConfig(Pending.Slot);
+    if (bRejected && Cfg)
+    {
+        RefundCharge(Pending.Slot, *Cfg);
+    }
+}
+
+void SkillComponent::ExpirePredictions()
+{
+    const float Now = GetWorldTime();
+    float NextExpire = FLT_MAX;
+    for (int32 i = PendingPredictions.Num() - 1; i >= 0; --i)
+    {
+        if (PendingPredictions[i].ExpireTime <= Now)
+        {
+            USkillActorPool::ReleaseSkillActor(PendingPredictions[i].Cosmetic.Get());
+            PendingPredictions.RemoveAt(i, 1, /*bAllowShrinking*/ false);
+        }
+        else
+        {
+            NextExpire = FMath::Min(NextExpire, PendingPredictions[i].ExpireTime);
+        }
+    }
+
+    if (PendingPredictions.Num() > 0)
+    {
+        GetWorld()->GetTimerManager().SetTimer(PredictionTimer, this, &SkillComponent::ExpirePredictions, FMath::Max(NextExpire - Now, 0.01f), false);
+    }
+}
+
+void SkillComponent::SetCooldownReduction(float NewReduction)
+{
+    NewReduction = FMath::Clamp(NewReduction, 0.f, 0.9f);
+    if (FMath::IsNearlyEqual(NewReduction, CooldownReduction)) return;
+
+    // 진행 중인 재충전의 남은 시간을 새 비율로 환산
+    const float Scale = (1.f - NewReduction) / (1.f - CooldownReduction);
+    CooldownReduction = NewReduction;
+
+    const float Now = GetWorldTime();
+    for (int32 i = 0; i < FSkillSlotIndex::Num; ++i)
+    {
+        const ESkillSlot Slot = FSkillSlotIndex::FromIndex(i);
+        const FSkillSlotRuntime& Rt = SlotRuntime[Slot];
+        if (!Rt.IsRecharging()) continue;
+
+        ScheduleRecharge(Slot, Now + FMath::Max(0.f, Rt.RechargeEndTime - Now) * Scale);
+        UpdateCooldownRepState(Slot);
+    }
+}
+
+void SkillComponent::ReduceCooldown(ESkillSlot Slot, float Seconds)
+{
+    const FSkillSlotRuntime* Rt = GetRuntime(Slot);
+    if (!Rt || !Rt->IsRecharging() || Seconds <= 0.f) return;
+
+    const float Now = GetWorldTime();
+    const float NewEnd = Rt->RechargeEndTime - Seconds;
+    if (NewEnd > Now)
+    {
+        ScheduleRecharge(Slot, NewEnd);
+        UpdateCooldownRepState(Slot);
+        return;
+    }
+
+    // 이미 지난 시각이면 바로 충전. 다음 충전은 지금부터 이어서 (초과 감소분이 연쇄 충전되지 않게)
+    FSkillSlotRuntime& Mutable = SlotRuntime[Slot];
+    if (USkillCooldownWheel* Wheel = GetCooldownWheel()) Wheel->Cancel(Mutable.RechargeTimer);
+    Mutable.RechargeEndTime = Now;
+    OnCooldownTimerExpired(Slot);
+}
+
+float SkillComponent::GetCooldownRemaining(ESkillSlot Slot) const
+{
+    const FSkillSlotRuntime* Rt = GetRuntime(Slot);
+    return (Rt && Rt->IsRecharging()) ? FMath::Max(0.f, Rt->RechargeEndTime - GetWorldTime()) : 0.f;
+}
+
+int32 SkillComponent::GetCharges(ESkillSlot Slot) const
+{
+    const FSkillSlotRuntime* Rt = GetRuntime(Slot);
+    return Rt ? Rt->Charges : 0;
+}
+
+void SkillComponent::ConsumeCharge(ESkillSlot Slot, const FSkillSlotConfig& Config, float ActivatedAt, float LatencyCompensation)
+{
+    FSkillSlotRuntime& Rt = SlotRuntime[Slot];
+
+    // 지연 보상: 클라이언트가 누른 시점엔 이미 찼을 충전을 먼저 채움
+    if (Rt.Charges <= 0 && Rt.IsRecharging() && Rt.RechargeEndTime - GetWorldTime() <= LatencyCompensation)
+    {
+        if (USkillCooldownWheel* Wheel = GetCooldownWheel()) Wheel->Cancel(Rt.RechargeTimer);
+        OnCooldownTimerExpired(Slot);
+    }
+
+    Rt.LastActivatedTime = ActivatedAt;
+    if (GetEffectiveCooldown(Config) <= 0.f) return; // 쿨다운 없는 슬롯은 충전을 쓰지 않음
+
+    Rt.Charges = FMath::Max(0, Rt.Charges - 1);
+    if (!Rt.IsRecharging() && Rt.Charges < Config.MaxCharges)
+    {
+        ScheduleRecharge(Slot, ActivatedAt + GetEffectiveCooldown(Config));
+    }
+    UpdateCooldownRepState(Slot);
+}
 
-    return ESkillActivateResult::InvalidClass;
+void SkillComponent::RefundCharge(ESkillSlot Slot, const FSkillSlotConfig& Config)
+{
+    FSkillSlotRuntime& Rt = SlotRuntime[Slot];
+    Rt.Charges = FMath::Min(Rt.Charges + 1, Config.MaxCharges);
+    if (Rt.Charges >= Config.MaxCharges)
+    {
+        ScheduleRecharge(Slot, 0.f);
+    }
+    UpdateCooldownRepState(Slot);
+}
+
+void SkillComponent::ScheduleRecharge(ESkillSlot Slot, float EndTime)
+{
+    FSkillSlotRuntime& Rt = SlotRuntime[Slot];
+    USkillCooldownWheel* Wheel = GetCooldownWheel();
+    if (Wheel) Wheel->Cancel(Rt.RechargeTimer);
+    else Rt.RechargeTimer.Invalidate();
+
+    Rt.RechargeEndTime = (EndTime > 0.f) ? EndTime : 0.f;
+    if (Wheel && EndTime > 0.f)
+    {
+        Rt.RechargeTimer = Wheel->Schedule(this, Slot, EndTime);
+    }
+}
+
+void SkillComponent::OnCooldownTimerExpired(ESkillSlot Slot)
+{
+    const FSkillSlotConfig* Cfg = GetConfig(Slot);
+    if (!Cfg) return;
+
+    // 휠에서 이미 해제된 예약
+    FSkillSlotRuntime& Rt = SlotRuntime[Slot];
+    Rt.RechargeTimer.Invalidate();
+
+    const float PrevEnd = Rt.RechargeEndTime;
+    Rt.Charges = FMath::Min(Rt.Charges + 1, Cfg->MaxCharges);
+    Rt.RechargeEndTime = 0.f;
+
+    // 다음 충전은 이전 종료 시각부터 이어서 → 프레임 지연이 누적되지 않음
+    if (Rt.Charges < Cfg->MaxCharges)
+    {
+        ScheduleRecharge(Slot, PrevEnd + GetEffectiveCooldown(*Cfg));
+    }
+    UpdateCooldownRepState(Slot);
+
+    OnCooldownReady.Broadcast(Slot, Rt.Charges);
+}
+
+void SkillComponent::UpdateCooldownRepState(ESkillSlot Slot)
+{
+    if (!GetOwner() || !GetOwner()->HasAuthority()) return;
+
+    const int32 Index = FSkillSlotIndex::ToIndex(Slot);
+    const FSkillSlotRuntime& Rt = SlotRuntime[Slot];
+    if (Rt.IsRecharging())
+    {
+        CooldownState.ActiveMask |= (uint8)(1 << Index);
+        CooldownState.EndCs[Index] = CombatNet::QuantizeTimeCs(GetNetTime() + (Rt.RechargeEndTime - GetWorldTime()));
+        CooldownState.Charges[Index] = (uint8)FMath::Clamp(Rt.Charges, 0, (1 << SkillNet::ChargeBits) - 1);
+    }
+    else
+    {
+        // 가득 찬 슬롯은 비트만 내림 (16비트 시각이 한 바퀴 돌 일 없음)
+        CooldownState.ActiveMask &= (uint8)~(1 << Index);
+        CooldownState.EndCs[Index] = 0;
+        CooldownState.Charges[Index] = 0;
+    }
+}
+
+void SkillComponent::OnRep_Cooldowns()
+{
+    // 서버 상태로 로컬 충전/재충전 보정. 아직 응답 전인 예측 슬롯은 건드리지 않음
+    const float NetNow = GetNetTime();
+    const float WorldNow = GetWorldTime();
+    for (int32 i = 0; i < FSkillSlotIndex::Num; ++i)
+    {
+        const ESkillSlot Slot = FSkillSlotIndex::FromIndex(i);
+        if (PendingPredictions.ContainsByPredicate([Slot](const FPredictedSkill& P) { return P.Slot == Slot; })) continue;
+
+        const FSkillSlotConfig* Cfg = GetConfig(Slot);
+        FSkillSlotRuntime& Rt = SlotRuntime[Slot];
+        if (!Cfg) continue;
+
+        if (CooldownState.ActiveMask & (1 << i))
+        {
+            Rt.Charges = CooldownState.Charges[i];
+            const float EndLocal = CombatNet::DequantizeTimeCs(CooldownState.EndCs[i], NetNow) - NetNow + WorldNow;
+            if (!Rt.IsRecharging() || !FMath::IsNearlyEqual(Rt.RechargeEndTime, EndLocal, 0.02f))
+            {
+                ScheduleRecharge(Slot, EndLocal);
+            }
+        }
+        else if (Rt.Charges < Cfg->MaxCharges)
+        {
+            // 로컬 휠보다 서버가 먼저 채운 경우
+            Rt.Charges = Cfg->MaxCharges;
+            ScheduleRecharge(Slot, 0.f);
+            OnCooldownReady.Broadcast(Slot, Rt.Charges);
+        }
+    }
+}
+
+USkillCooldownWheel* SkillComponent::GetCooldownWheel() const
+{
+    const UWorld* World = GetWorld();
+    return World ? World->GetSubsystem<USkillCooldownWheel>() : nullptr;
+}
+
+bool SkillComponent::IsPredictingClient() const
+{
+    const APawn* Pawn = Cast<APawn>(GetOwner());
+    return Pawn && !Pawn->HasAuthority() && Pawn->IsLocallyControlled();
+}
+
+float SkillComponent::GetNetTime() const
+{
+    const UWorld* World = GetWorld();
+    if (!World) return 0.f;
+    const AGameStateBase* GS = World->GetGameState();
+    return GS ? GS->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
 }
 
 AActor* SkillComponent::SpawnSkillAt(ESkillSlot Slot, const FTransform& SpawnTransform, const FSkillSpawnParams& Params)
 {
     const FSkillSlotConfig* Cfg = GetConfig(Slot);
-    if (!GetWorld() || !Cfg || !Cfg->SkillObjectClass) return nullptr;
+    return Cfg ? SpawnSkillWithConfig(Slot, *Cfg, SpawnTransform, Params) : nullptr;
+}
 
-    FActorSpawnParameters SP;
-    SP.Owner = OwnerCharacter ? static_cast<AActor*>(OwnerCharacter) : GetOwner();
-    SP.Instigator = OwnerCharacter;
-    SP.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+AActor* SkillComponent::SpawnSkillWithConfig(ESkillSlot Slot, const FSkillSlotConfig& Config, const FTransform& SpawnTransform, const FSkillSpawnParams& Params)
+{
+    return AcquireSkillActor(Config.SkillObjectClass, Slot, SpawnTransform, Params);
+}
+
+AActor* SkillComponent::AcquireSkillActor(TSubclassOf<AActor> Class, ESkillSlot Slot, const FTransform& SpawnTransform, const FSkillSpawnParams& Params)
+{
+    USkillActorPool* Pool = GetWorld() ? GetWorld()->GetSubsystem<USkillActorPool>() : nullptr;
+    if (!Pool || !Class) return nullptr;
 
-    AActor* Spawned = GetWorld()->SpawnActor<AActor>(Cfg->SkillObjectClass, SpawnTransform, SP);
-    if (Spawned)
+    AActor* SpawnOwner = OwnerCharacter ? static_cast<AActor*>(OwnerCharacter) : GetOwner();
+    bool bFromPool = false;
+    AActor* Spawned = Pool->Acquire(Class, SpawnTransform, SpawnOwner, OwnerCharacter, bFromPool);
+
+    // 스킬별 초기화(데미지/속도/팀/시전자 전달 등)는 액터 쪽 인터페이스에서. 끝나면 USkillActorPool::ReleaseSkillActor로 반납
+    if (Spawned && Spawned->Implements<USkillPoolable>())
     {
-        ConfigureSpawnedActor(Slot, Spawned, Params);
+        ISkillPoolable::Execute_OnSkillAcquired(Spawned, this, Slot, Params);
     }
     return Spawned;
 }
 
-FTransform SkillComponent::BuildSpawnTransform(ESkillSlot Slot, const FSkillSpawnParams& Params) const
+SkillComponent::FSpawnBasis SkillComponent::GatherSpawnBasis(const FSkillSlotConfig& Config) const
 {
-    const FSkillSlotConfig* Cfg = GetConfig(Slot);
     const AActor* OwnerActor = GetOwner();
     const USkeletalMeshComponent* Mesh = OwnerCharacter ? OwnerCharacter->GetMesh() : nullptr;
 
-    FTransform Base;
-    if (Cfg && Mesh && Cfg->SpawnSocketName != NAME_None && Mesh->DoesSocketExist(Cfg->SpawnSocketName))
+    FSpawnBasis Basis;
+    if (Mesh && Config.SpawnSocketName != NAME_None && Mesh->DoesSocketExist(Config.SpawnSocketName))
     {
-        Base = Mesh->GetSocketTransform(Cfg->SpawnSocketName, RTS_World);
+        Basis.Base = Mesh->GetSocketTransform(Config.SpawnSocketName, RTS_World);
     }
     else
     {
-        Base = OwnerActor ? OwnerActor->GetActorTransform() : FTransform::Identity;
+        Basis.Base = OwnerActor ? OwnerActor->GetActorTransform() : FTransform::Identity;
     }
 
-    // 오프셋(로컬) 적용
-    if (Cfg)
+    if (Config.bUseOwnerControlRotation && OwnerCharacter && OwnerCharacter->GetController())
     {
-        Base.AddToTranslation(Base.GetRotation().RotateVector(Cfg->SpawnOffset));
+        Basis.ControlRotation = OwnerCharacter->GetController()->GetControlRotation();
+        Basis.bHasControlRotation = true;
     }
+    return Basis;
+}
+
+FTransform SkillComponent::ComposeSpawnTransform(const FSkillSlotConfig& Config, const FSkillSpawnParams& Params, const FSpawnBasis& Basis)
+{
+    FTransform Base = Basis.Base;
+
+    // 오프셋(로컬) 적용
+    Base.AddToTranslation(Base.GetRotation().RotateVector(Config.SpawnOffset));
 
     // 회전 결정
     FRotator UseRot = Base.Rotator();
@@ -148,9 +748,9 @@ FTransform SkillComponent::BuildSpawnTransform(ESkillSlot Slot, const FSkillSpaw
         {
             Fwd = Params.Direction.GetSafeNormal();
         }
-        else if (Cfg && Cfg->bUseOwnerControlRotation && OwnerCharacter && OwnerCharacter->GetController())
+        else if (Basis.bHasControlRotation)
         {
-            UseRot = OwnerCharacter->GetController()->GetControlRotation();
+            UseRot = Basis.ControlRotation;
             Fwd = UseRot.Vector();
         }
         else
@@ -168,14 +768,14 @@ FTransform SkillComponent::BuildSpawnTransform(ESkillSlot Slot, const FSkillSpaw
     return Base;
 }
 
-void SkillComponent::PreBuildSpawnTransform(ESkillSlot /*Slot*/, const FSkillSpawnParams& /*Params*/, FTransform& /*InOutTransform*/) const
+FTransform SkillComponent::BuildSpawnTransform(const FSkillSlotConfig& Config, const FSkillSpawnParams& Params) const
 {
-    // 자식에서 필요 시 오버라이드(지면 스냅/에임 보정 등)
+    return ComposeSpawnTransform(Config, Params, GatherSpawnBasis(Config));
 }
 
-void SkillComponent::ConfigureSpawnedActor(ESkillSlot /*Slot*/, AActor* /*Spawned*/, const FSkillSpawnParams& /*Params*/)
+void SkillComponent::PreBuildSpawnTransform(ESkillSlot /*Slot*/, const FSkillSpawnParams& /*Params*/, FTransform& /*InOutTransform*/) const
 {
-    // 자식에서 스킬별 초기화(데미지/속도/팀/시전자 전달 등)
+    // 자식에서 필요 시 오버라이드(지면 스냅/에임 보정 등)
 }
 
 bool SkillComponent::ConsumeResource(ESkillSlot /*Slot*/, const FSkillSlotConfig& /*Config*/)
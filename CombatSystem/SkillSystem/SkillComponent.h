@@ -5,6 +5,10 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "SkillSlotTable.h"
+#include "SkillCooldownWheel.h"
+#include "CombatNet.h"
+#include "Engine/NetSerialization.h"
 #include "DRSkillComponent.generated.h"
 
 class BaseCharacter;
@@ -18,8 +22,12 @@ enum class ESkillSlot : uint8
     E UMETA(DisplayName = "E"),
     R UMETA(DisplayName = "R"),
     T UMETA(DisplayName = "T"),
+
+    Count UMETA(Hidden)
 };
 
+using FSkillSlotIndex = TSkillSlotIndex<ESkillSlot>;
+
 /** 활성화 결과 */
 UENUM(BlueprintType)
 enum class ESkillActivateResult : uint8
@@ -76,16 +84,28 @@ struct FSkillSlotConfig
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skill|Setup")
     bool bAttachToOwner = false;
 
-    /** 쿨다운(초) */
+    /** 쿨다운(초). 충전식이면 충전 1회당 시간 */
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skill|Cost")
     float CooldownSeconds = 0.5f;
 
+    /** 최대 충전 수(1 = 일반 쿨다운) */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skill|Cost", meta = (ClampMin = "1", ClampMax = "7"))
+    int32 MaxCharges = 1;
+
     /** 마나/스태미나 코스트 */
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skill|Cost")
     float ManaCost = 0.f;
+
+    /** 소유 클라이언트 예측용 코스메틱(비복제). 서버 액터가 도착하면 반납. 비우면 예측 연출 없음 */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skill|Net")
+    TSubclassOf<AActor> PredictedCosmeticClass = nullptr;
+
+    /** BeginPlay에서 미리 만들어 둘 풀 액터 수(동시에 살아있는 최대 개수 기준) */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skill|Pool", meta = (ClampMin = "0"))
+    int32 PoolPrewarmCount = 4;
 };
 
-/** 런타임 상태(마지막 사용 시각 등) */
+/** 런타임 상태(충전 수/재충전 종료 시각 등) */
 USTRUCT(BlueprintType)
 struct FSkillSlotRuntime
 {
@@ -93,40 +113,200 @@ struct FSkillSlotRuntime
 
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Skill|Runtime")
     float LastActivatedTime = -FLT_MAX;
+
+    /** 남은 충전 수 (BeginPlay에서 MaxCharges로 채움) */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Skill|Runtime")
+    int32 Charges = 0;
+
+    /** 재충전 중이면 다음 충전이 차는 월드 시각, 아니면 0 */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Skill|Runtime")
+    float RechargeEndTime = 0.f;
+
+    /** USkillCooldownWheel 예약 */
+    FSkillCooldownHandle RechargeTimer;
+
+    bool IsRecharging() const { return RechargeTimer.IsValid(); }
+};
+
+namespace SkillNet
+{
+    constexpr int32 SlotBits = 3; // 슬롯 최대 8개
+    constexpr int32 ChargeBits = 3; // MaxCharges 최대 7
+    static_assert(FSkillSlotIndex::Num <= (1 << SlotBits), "SlotBits too small for ESkillSlot");
+    static_assert(FSkillSlotIndex::Num <= 8, "Cooldown ActiveMask is 8 bits");
+}
+
+// 클라이언트 → 서버 스킬 활성화 (타깃 없을 때 약 58비트)
+USTRUCT()
+struct FSkillNetRequest
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    uint8 Slot = 0;
+
+    UPROPERTY()
+    uint8 InputSeq = 0;
+
+    UPROPERTY()
+    uint16 ClientTimeMs = 0;
+
+    // 조준 방향 (CombatNet::QuantizeDirection)
+    UPROPERTY()
+    uint16 AimYaw = 0;
+
+    UPROPERTY()
+    uint16 AimPitch = 0;
+
+    UPROPERTY()
+    bool bHasTarget = false;
+
+    UPROPERTY()
+    FVector_NetQuantize TargetLocation = FVector::ZeroVector;
+
+    UPROPERTY()
+    int32 Meta = 0;
+
+    bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FSkillNetRequest> : public TStructOpsTypeTraitsBase2<FSkillNetRequest>
+{
+    enum { WithNetSerializer = true };
+};
+
+// 소유 클라이언트용 쿨다운 상태: 재충전 중인 슬롯 비트필드 + 해당 슬롯의 충전 종료 시각(10ms 단위 16비트)/남은 충전 수(3비트)만 전송
+USTRUCT()
+struct FSkillCooldownRepState
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    uint8 ActiveMask = 0;
+
+    UPROPERTY()
+    uint16 EndCs[(uint8)ESkillSlot::Count] = {};
+
+    UPROPERTY()
+    uint8 Charges[(uint8)ESkillSlot::Count] = {};
+
+    bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FSkillCooldownRepState> : public TStructOpsTypeTraitsBase2<FSkillCooldownRepState>
+{
+    enum { WithNetSerializer = true };
+};
+
+class SkillComponent;
+
+/** 배치 활성화 요청(AI 디렉터 등에서 한 프레임 분량을 모아 전달) */
+USTRUCT(BlueprintType)
+struct FSkillBatchRequest
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill")
+    SkillComponent* Component = nullptr;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill")
+    ESkillSlot Slot = ESkillSlot::Q;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill")
+    FSkillSpawnParams Params;
+};
+
+/** 배치 활성화 결과(요청과 같은 인덱스) */
+USTRUCT(BlueprintType)
+struct FSkillBatchResult
+{
+    GENERATED_BODY()
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Skill")
+    ESkillActivateResult Result = ESkillActivateResult::NoWorld;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Skill")
+    AActor* Spawned = nullptr;
 };
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnSkillSpawned, ESkillSlot, Slot, AActor*, SpawnedActor);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnSkillCooldownReady, ESkillSlot, Slot, int32, Charges);
 
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class DUSKREGION_API SkillComponent : public UActorComponent
 {
     GENERATED_BODY()
 
+    friend class USkillCooldownWheel;
+
 public:
     SkillComponent();
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 public:
     /** 오너 캐릭터(자동 캐싱) */
     UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Skill")
     BaseCharacter* OwnerCharacter = nullptr;
 
-    /** 슬롯 설정들(에디터에서 세팅) */
-    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skill|Setup")
-    TMap<ESkillSlot, FSkillSlotConfig> SlotConfigs;
+    /** 슬롯 설정들(에디터에서 세팅). 슬롯 enum 순서의 고정 배열 */
+    UPROPERTY(EditAnywhere, EditFixedSize, Category = "Skill|Setup", meta = (ArraySizeEnum = "ESkillSlot"))
+    FSkillSlotConfig SlotTable[(uint8)ESkillSlot::Count];
 
-    /** 런타임 타이머/상태 */
-    UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Skill|Runtime")
-    TMap<ESkillSlot, FSkillSlotRuntime> SlotRuntime;
+    /** 구버전 TMap 데이터 로드용. PostLoad에서 SlotTable로 옮기고 비운다 */
+    UPROPERTY()
+    TMap<ESkillSlot, FSkillSlotConfig> SlotConfigs;
 
-    /** 스폰 이벤트(블루프린트) */
+    /** 스폰 이벤트(블루프린트). 예측 클라이언트에서는 코스메틱 액터로 호출 */
     UPROPERTY(BlueprintAssignable, Category = "Skill|Event")
     FOnSkillSpawned OnSkillSpawned;
 
+    /** 충전이 하나 찰 때마다(폴링 없이 UI/AI가 구독) */
+    UPROPERTY(BlueprintAssignable, Category = "Skill|Event")
+    FOnSkillCooldownReady OnCooldownReady;
+
+    /** 쿨다운 감소율(0~0.9). SetCooldownReduction으로 변경하면 진행 중인 재충전도 비율대로 조정 */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skill|Cost", meta = (ClampMin = "0", ClampMax = "0.9"))
+    float CooldownReduction = 0.f;
+
+    /** 서버가 클라이언트 타임스탬프만큼 쿨다운을 앞당겨 줄 최대치(초) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill|Net", meta = (ClampMin = "0"))
+    float MaxLatencyCompensation = 0.25f;
+
+    /** 서버 확인이 없을 때 예측 코스메틱을 반납하기까지의 시간(초) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill|Net", meta = (ClampMin = "0"))
+    float PredictedCosmeticTimeout = 0.5f;
+
 public:
+    /** 슬롯 설정(블루프린트 조회용 복사본) */
+    UFUNCTION(BlueprintPure, Category = "Skill")
+    FSkillSlotConfig GetSlotConfig(ESkillSlot Slot) const;
+
+    /** 슬롯 런타임 상태(블루프린트 조회용 복사본) */
+    UFUNCTION(BlueprintPure, Category = "Skill|Runtime")
+    FSkillSlotRuntime GetSlotRuntime(ESkillSlot Slot) const;
+
+    /** 쿨다운 감소율 변경 (진행 중인 재충전의 남은 시간도 새 비율로 환산) */
+    UFUNCTION(BlueprintCallable, Category = "Skill|Cost")
+    void SetCooldownReduction(float NewReduction);
+
+    /** 현재 재충전을 Seconds만큼 단축(적중 시 쿨 감소 등) */
+    UFUNCTION(BlueprintCallable, Category = "Skill|Cost")
+    void ReduceCooldown(ESkillSlot Slot, float Seconds);
+
+    /** 다음 충전까지 남은 시간(재충전 중이 아니면 0) */
+    UFUNCTION(BlueprintPure, Category = "Skill|Cost")
+    float GetCooldownRemaining(ESkillSlot Slot) const;
+
+    UFUNCTION(BlueprintPure, Category = "Skill|Cost")
+    int32 GetCharges(ESkillSlot Slot) const;
+
     /** 지금 사용 가능? */
     UFUNCTION(BlueprintCallable, Category = "Skill")
     bool CanActivate(ESkillSlot Slot) const;
@@ -135,29 +315,129 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Skill")
     ESkillActivateResult ActivateSkill(ESkillSlot Slot, const FSkillSpawnParams& Params, AActor*& OutSpawned);
 
-    /** 임의 트랜스폼으로 스폰(고급) */
+    /**
+     * 여러 캐스터의 활성화를 한 번에 처리: 쿨다운/자원 검증 1패스 → 스폰 트랜스폼 병렬 계산 → 클래스별로 묶어 스폰.
+     * 결과는 요청과 같은 인덱스. 소켓/컨트롤 회전 읽기와 PreBuildSpawnTransform 훅은 게임 스레드, 순수 트랜스폼 계산만 병렬.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Skill")
+    static void ActivateSkillBatch(const TArray<FSkillBatchRequest>& Requests, TArray<FSkillBatchResult>& OutResults);
+
+    /** 임의 트랜스폼으로 스폰(고급). 풀에서 꺼내고 ISkillPoolable::OnSkillAcquired로 초기화 */
     UFUNCTION(BlueprintCallable, Category = "Skill")
     AActor* SpawnSkillAt(ESkillSlot Slot, const FTransform& SpawnTransform, const FSkillSpawnParams& Params);
 
 protected:
-    /** 슬롯 설정 가져오기 */
-    const FSkillSlotConfig* GetConfig(ESkillSlot Slot) const;
+    virtual void PostLoad() override;
+
+    /** 슬롯 설정 가져오기(범위 밖이면 nullptr). 활성화당 한 번만 해석해 아래로 넘긴다 */
+    const FSkillSlotConfig* GetConfig(ESkillSlot Slot) const
+    {
+        return FSkillSlotIndex::IsValid(Slot) ? &SlotTable[FSkillSlotIndex::ToIndex(Slot)] : nullptr;
+    }
+
+    /** 슬롯 런타임 가져오기(범위 밖이면 nullptr) */
+    FSkillSlotRuntime* GetRuntime(ESkillSlot Slot) { return SlotRuntime.Find(Slot); }
+    const FSkillSlotRuntime* GetRuntime(ESkillSlot Slot) const { return SlotRuntime.Find(Slot); }
 
-    /** 슬롯 런타임 가져오기(없으면 생성) */
-    FSkillSlotRuntime& GetOrCreateRuntime(ESkillSlot Slot);
+    /** 이미 해석된 설정으로 스폰 */
+    AActor* SpawnSkillWithConfig(ESkillSlot Slot, const FSkillSlotConfig& Config, const FTransform& SpawnTransform, const FSkillSpawnParams& Params);
+
+    /** 풀에서 Class 액터를 꺼내 ISkillPoolable로 초기화 */
+    AActor* AcquireSkillActor(TSubclassOf<AActor> Class, ESkillSlot Slot, const FTransform& SpawnTransform, const FSkillSpawnParams& Params);
+
+    /** 스폰 트랜스폼 입력: 소켓(또는 액터) 기준 트랜스폼 + 컨트롤 회전. 게임 스레드에서만 수집 */
+    struct FSpawnBasis
+    {
+        FTransform Base = FTransform::Identity;
+        FRotator ControlRotation = FRotator::ZeroRotator;
+        bool bHasControlRotation = false;
+    };
+    FSpawnBasis GatherSpawnBasis(const FSkillSlotConfig& Config) const;
+
+    /** 수집된 입력으로 오프셋/회전 적용 (UObject 접근 없음 → 워커 스레드 안전) */
+    static FTransform ComposeSpawnTransform(const FSkillSlotConfig& Config, const FSkillSpawnParams& Params, const FSpawnBasis& Basis);
 
     /** Transform 생성(소켓/오프셋/컨트롤 회전) */
-    FTransform BuildSpawnTransform(ESkillSlot Slot, const FSkillSpawnParams& Params) const;
+    FTransform BuildSpawnTransform(const FSkillSlotConfig& Config, const FSkillSpawnParams& Params) const;
 
-    /** 스폰 전 트랜스폼 수정 훅 */
-    virtual void PreBuildSpawnTransform(ESkillSlot Slot, const FSkillSpawnParams& Params, FTransform& InOutTransform) const;
+    /** 활성화 단계: 충전/자원 검증 → (충전 소모) → 트랜스폼 계산 → 스폰/어태치/이벤트 */
+    ESkillActivateResult ValidateActivation(ESkillSlot Slot, const FSkillSlotConfig& Config, float LatencyCompensation);
+    FTransform ComputeSpawnTransform(ESkillSlot Slot, const FSkillSlotConfig& Config, const FSkillSpawnParams& Params) const;
+    AActor* FinishActivation(ESkillSlot Slot, const FSkillSlotConfig& Config, const FSkillSpawnParams& Params, const FTransform& SpawnTransform);
 
-    /** 스폰 후 액터 설정 훅 */
-    virtual void ConfigureSpawnedActor(ESkillSlot Slot, AActor* Spawned, const FSkillSpawnParams& Params);
+    /** 스폰 전 트랜스폼 수정 훅 (항상 게임 스레드) */
+    virtual void PreBuildSpawnTransform(ESkillSlot Slot, const FSkillSpawnParams& Params, FTransform& InOutTransform) const;
 
     /** 리소스 소비 훅(슬롯/코스트 기반) */
     virtual bool ConsumeResource(ESkillSlot Slot, const FSkillSlotConfig& Config);
 
     /** 현재 월드 타임 */
     float GetWorldTime() const;
+
+    /** 런타임 타이머/상태 (슬롯 enum 인덱스, 고정 크기) */
+    TSkillSlotTable<FSkillSlotRuntime, ESkillSlot> SlotRuntime;
+
+    // ---- 네트워크 ----
+    UPROPERTY(ReplicatedUsing = OnRep_Cooldowns)
+    FSkillCooldownRepState CooldownState;
+
+    UFUNCTION()
+    void OnRep_Cooldowns();
+
+    UFUNCTION(Server, Reliable)
+    void ServerActivateSkill(FSkillNetRequest Request);
+
+    UFUNCTION(Client, Reliable)
+    void ClientRejectSkill(uint8 InputSeq);
+
+    /** 서버 액터가 아직 복제되지 않았으면 Authoritative는 null → 예측 코스메틱은 타임아웃까지 유지 */
+    UFUNCTION(Client, Unreliable)
+    void ClientConfirmSkill(uint8 InputSeq, AActor* Authoritative);
+
+    /** 서버/스탠드얼론 활성화. LatencyCompensation만큼 충전 판정과 재충전 시작 시각을 앞당김 */
+    ESkillActivateResult ActivateAuthoritative(ESkillSlot Slot, const FSkillSlotConfig& Config, const FSkillSpawnParams& Params, float LatencyCompensation, AActor*& OutSpawned);
+
+    /** 소유 클라이언트: 쿨다운 예측 + 코스메틱 스폰 + 서버 RPC */
+    ESkillActivateResult ActivatePredicted(ESkillSlot Slot, const FSkillSlotConfig& Config, const FSkillSpawnParams& Params, AActor*& OutSpawned);
+
+    bool IsPredictingClient() const;
+    float GetNetTime() const;
+
+    // ---- 충전/쿨다운 ----
+    float GetEffectiveCooldown(const FSkillSlotConfig& Config) const { return Config.CooldownSeconds * (1.f - CooldownReduction); }
+
+    /** 충전 1 소모. 비어 있던 재충전이면 ActivatedAt부터 시작. LatencyCompensation 안에 찰 충전은 먼저 채움 */
+    void ConsumeCharge(ESkillSlot Slot, const FSkillSlotConfig& Config, float ActivatedAt, float LatencyCompensation = 0.f);
+
+    /** 스폰 실패/예측 거부 시 충전 반환 */
+    void RefundCharge(ESkillSlot Slot, const FSkillSlotConfig& Config);
+
+    /** 재충전 종료 시각을 (재)예약. EndTime <= 0이면 예약 취소 */
+    void ScheduleRecharge(ESkillSlot Slot, float EndTime);
+
+    /** USkillCooldownWheel 콜백: 충전 1 증가 + 이벤트, 아직 덜 찼으면 다음 재충전 예약 */
+    void OnCooldownTimerExpired(ESkillSlot Slot);
+
+    /** 서버: 슬롯 충전 상태를 복제 구조체에 반영 */
+    void UpdateCooldownRepState(ESkillSlot Slot);
+
+    USkillCooldownWheel* GetCooldownWheel() const;
+
+    struct FPredictedSkill
+    {
+        uint8 InputSeq = 0;
+        ESkillSlot Slot = ESkillSlot::Q;
+        float ExpireTime = 0.f;
+        TWeakObjectPtr<AActor> Cosmetic;
+    };
+
+    TArray<FPredictedSkill, TInlineAllocator<4>> PendingPredictions;
+    uint8 LocalInputSeq = 0;
+    FTimerHandle PredictionTimer;
+
+    /** BeginPlay에서 PredictedCosmeticClass까지 풀 예약했는지 (EndPlay에서 같은 만큼 해제) */
+    bool bCosmeticsReserved = false;
+
+    void ExpirePredictions();
+    void ResolvePrediction(uint8 InputSeq, bool bRejected);
 };
@@ -0,0 +1,159 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "SkillCooldownWheel.h"
+#include "DRSkillComponent.h"
+#include "CombatStats.h"
+#include "Engine/World.h"
+
+FSkillCooldownHandle USkillCooldownWheel::Schedule(SkillComponent* Owner, ESkillSlot Slot, float ExpireTime)
+{
+    FSkillCooldownHandle Handle;
+    if (!Owner) return Handle;
+
+    // 비어 있는 동안은 틱하지 않으므로 현재 월드 틱으로 재동기화 (밀린 빈 틱을 한 프레임에 돌지 않게)
+    if (NumScheduled == 0)
+    {
+        SyncToWorldTime();
+    }
+
+    const int32 Index = FreeEntries.Num() > 0 ? FreeEntries.Pop(/*bAllowShrinking*/ false) : Entries.AddDefaulted();
+    FEntry& E = Entries[Index];
+    E.Owner = Owner;
+    E.Slot = Slot;
+    // 올림: 만료 시각보다 일찍 발동하지 않도록. 이미 지났으면 다음 틱
+    E.ExpireTick = FMath::Max<uint64>(CurrentTick + 1, (uint64)FMath::CeilToInt64(ExpireTime / TickSeconds));
+    E.bActive = true;
+    ++E.Serial;
+
+    Insert(Index);
+    ++NumScheduled;
+
+    Handle.Index = Index;
+    Handle.Serial = E.Serial;
+    return Handle;
+}
+
+void USkillCooldownWheel::Cancel(FSkillCooldownHandle& Handle)
+{
+    if (Entries.IsValidIndex(Handle.Index) && Entries[Handle.Index].bActive && Entries[Handle.Index].Serial == Handle.Serial)
+    {
+        FreeEntry(Handle.Index);
+    }
+    Handle.Invalidate();
+}
+
+TStatId USkillCooldownWheel::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USkillCooldownWheel, STATGROUP_Tickables);
+}
+
+void USkillCooldownWheel::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    const UWorld* World = GetWorld();
+    if (!World) return;
+
+    COMBAT_SCOPE(STAT_CombatCooldownWheel);
+
+    // 긴 프레임이어도 지난 틱을 모두 처리 (빈 칸은 인덱스 계산만)
+    const uint64 Target = ToTick(World->GetTimeSeconds());
+    while (CurrentTick < Target && NumScheduled > 0)
+    {
+        ++CurrentTick;
+        ProcessTick();
+    }
+    CurrentTick = FMath::Max(CurrentTick, Target);
+}
+
+void USkillCooldownWheel::SyncToWorldTime()
+{
+    const UWorld* World = GetWorld();
+    if (!World) return;
+
+    CurrentTick = ToTick(World->GetTimeSeconds());
+    // 남은 항목은 모두 취소된 것(시리얼 불일치) → 칸 위치가 바뀌기 전에 비움 (용량 유지)
+    for (int32 Level = 0; Level < NumLevels; ++Level)
+    {
+        for (int32 SlotIndex = 0; SlotIndex < NumSlots; ++SlotIndex)
+        {
+            Buckets[Level][SlotIndex].Reset();
+        }
+    }
+}
+
+void USkillCooldownWheel::Insert(int32 EntryIndex)
+{
+    const FEntry& E = Entries[EntryIndex];
+    const uint64 Delta = E.ExpireTick - CurrentTick;
+
+    // 남은 틱 수로 레벨 결정, 칸은 만료 틱의 해당 레벨 비트
+    int32 Level = 0;
+    while (Level < NumLevels - 1 && Delta >= (uint64(1) << (SlotBits * (Level + 1))))
+    {
+        ++Level;
+    }
+    // 최상위 범위를 넘는 예약은 최상위 마지막 칸에서 캐스케이드 때 다시 배치
+    const uint64 Tick = FMath::Min(E.ExpireTick, CurrentTick + (uint64(1) << (SlotBits * NumLevels)) - 1);
+    const int32 SlotIndex = (int32)((Tick >> (SlotBits * Level)) & (NumSlots - 1));
+
+    Buckets[Level][SlotIndex].Add({ EntryIndex, E.Serial });
+}
+
+void USkillCooldownWheel::Cascade(int32 Level)
+{
+    const int32 SlotIndex = (int32)((CurrentTick >> (SlotBits * Level)) & (NumSlots - 1));
+
+    Scratch.Reset();
+    Swap(Scratch, Buckets[Level][SlotIndex]);
+    for (const FBucketItem& Item : Scratch)
+    {
+        if (Entries[Item.Index].bActive && Entries[Item.Index].Serial == Item.Serial)
+        {
+            Insert(Item.Index);
+        }
+    }
+}
+
+void USkillCooldownWheel::ProcessTick()
+{
+    // 하위 레벨이 한 바퀴 돌면 상위 레벨의 현재 칸을 내려보냄
+    for (int32 Level = 1; Level < NumLevels; ++Level)
+    {
+        if ((CurrentTick & ((uint64(1) << (SlotBits * Level)) - 1)) != 0) break;
+        Cascade(Level);
+    }
+
+    TArray<FBucketItem>& Bucket = Buckets[0][CurrentTick & (NumSlots - 1)];
+    if (Bucket.Num() == 0) return;
+
+    // 콜백에서 재예약할 수 있으므로 비운 뒤 처리
+    Scratch.Reset();
+    Swap(Scratch, Bucket);
+    for (const FBucketItem& Item : Scratch)
+    {
+        FEntry& E = Entries[Item.Index];
+        if (!E.bActive || E.Serial != Item.Serial) continue;
+
+        SkillComponent* Owner = E.Owner.Get();
+        const ESkillSlot Slot = E.Slot;
+        FreeEntry(Item.Index);
+        INC_DWORD_STAT(STAT_CombatCooldownsExpired);
+
+        if (IsValid(Owner))
+        {
+            Owner->OnCooldownTimerExpired(Slot);
+        }
+    }
+}
+
+void USkillCooldownWheel::FreeEntry(int32 EntryIndex)
+{
+    FEntry& E = Entries[EntryIndex];
+    E.bActive = false;
+    E.Owner.Reset();
+    ++E.Serial;
+    FreeEntries.Add(EntryIndex);
+    --NumScheduled;
+}
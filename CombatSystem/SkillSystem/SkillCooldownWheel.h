@@ -0,0 +1,83 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SkillCooldownWheel.generated.h"
+
+class SkillComponent;
+enum class ESkillSlot : uint8;
+
+/** 휠에 예약된 쿨다운 타이머 핸들 (재사용된 엔트리와 구분하기 위해 시리얼 포함) */
+struct FSkillCooldownHandle
+{
+    int32 Index = INDEX_NONE;
+    uint32 Serial = 0;
+
+    bool IsValid() const { return Index != INDEX_NONE; }
+    void Invalidate() { Index = INDEX_NONE; Serial = 0; }
+};
+
+/**
+ * 모든 SkillComponent의 쿨다운/충전 타이머를 관리하는 계층형 타이밍 휠 (월드 단위).
+ * 10ms 틱, 레벨당 64칸 × 4레벨(약 46시간). 프레임 비용은 만료/캐스케이드되는 타이머 수에만 비례한다.
+ */
+UCLASS()
+class DUSKREGION_API USkillCooldownWheel : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    static constexpr float TickSeconds = 0.01f;
+
+    /** ExpireTime(월드 시간)에 Owner->OnCooldownTimerExpired(Slot) 호출 예약 */
+    FSkillCooldownHandle Schedule(SkillComponent* Owner, ESkillSlot Slot, float ExpireTime);
+
+    /** 예약 취소 (이미 만료/취소된 핸들이면 무시). 핸들은 무효화된다 */
+    void Cancel(FSkillCooldownHandle& Handle);
+
+    int32 GetNumScheduled() const { return NumScheduled; }
+
+    // FTickableGameObject
+    virtual void Tick(float DeltaTime) override;
+    virtual bool IsTickable() const override { return NumScheduled > 0; }
+    virtual TStatId GetStatId() const override;
+
+private:
+    static constexpr int32 SlotBits = 6;
+    static constexpr int32 NumSlots = 1 << SlotBits;
+    static constexpr int32 NumLevels = 4;
+
+    struct FEntry
+    {
+        TWeakObjectPtr<SkillComponent> Owner;
+        uint64 ExpireTick = 0;
+        uint32 Serial = 0;
+        ESkillSlot Slot = (ESkillSlot)0;
+        bool bActive = false;
+    };
+
+    // 버킷에는 (엔트리 인덱스, 시리얼)만 저장. 취소된 엔트리는 시리얼 불일치로 건너뜀
+    struct FBucketItem
+    {
+        int32 Index;
+        uint32 Serial;
+    };
+
+    TArray<FEntry> Entries;
+    TArray<int32> FreeEntries;
+    TArray<FBucketItem> Buckets[NumLevels][NumSlots];
+    TArray<FBucketItem> Scratch;
+
+    uint64 CurrentTick = 0;
+    int32 NumScheduled = 0;
+
+    uint64 ToTick(float Seconds) const { return (uint64)FMath::Max<int64>(0, FMath::FloorToInt64(Seconds / TickSeconds)); }
+    // 예약이 없을 때만 호출: CurrentTick을 월드 시간에 맞추고 남은(취소된) 버킷 항목 정리
+    void SyncToWorldTime();
+    void Insert(int32 EntryIndex);
+    void Cascade(int32 Level);
+    void ProcessTick();
+    void FreeEntry(int32 EntryIndex);
+};
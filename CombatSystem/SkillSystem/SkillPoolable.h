@@ -0,0 +1,32 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "DRSkillComponent.h"
+#include "SkillPoolable.generated.h"
+
+UINTERFACE(MinimalAPI, BlueprintType)
+class USkillPoolable : public UInterface
+{
+    GENERATED_BODY()
+};
+
+/**
+ * 풀링되는 스킬 액터가 구현하는 인터페이스.
+ * 스폰/파괴 대신 풀에서 꺼낼 때 OnSkillAcquired로 초기화하고, 끝나면 ReleaseSkillActor로 반납한다.
+ */
+class DUSKREGION_API ISkillPoolable
+{
+    GENERATED_BODY()
+
+public:
+    /** 풀에서 꺼내 배치된 직후(트랜스폼/오너 설정 완료). 데미지/속도/팀/시전자 전달 등 스킬별 초기화 */
+    UFUNCTION(BlueprintNativeEvent, Category = "Skill|Pool")
+    void OnSkillAcquired(SkillComponent* Source, ESkillSlot Slot, const FSkillSpawnParams& Params);
+
+    /** 풀로 반납되기 직전. 이동/이펙트/타이머 등 상태 초기화 */
+    UFUNCTION(BlueprintNativeEvent, Category = "Skill|Pool")
+    void OnSkillReleased();
+};
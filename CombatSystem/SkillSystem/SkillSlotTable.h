@@ -0,0 +1,57 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 슬롯 enum → 연속 배열 인덱스. 슬롯 enum은 0부터 연속이고 마지막에 Count(Hidden)를 둔다.
+ * 콤보/궁극기 등 슬롯 종류가 늘면 enum만 추가하거나 별도 enum으로 인스턴스화.
+ */
+template<typename SlotEnum, int32 NumSlots = (int32)SlotEnum::Count>
+struct TSkillSlotIndex
+{
+    static_assert(NumSlots > 0, "Slot enum must have at least one slot");
+
+    static constexpr int32 Num = NumSlots;
+
+    static FORCEINLINE bool IsValid(SlotEnum Slot) { return (uint32)Slot < (uint32)NumSlots; }
+    static FORCEINLINE int32 ToIndex(SlotEnum Slot) { return (int32)Slot; }
+    static FORCEINLINE SlotEnum FromIndex(int32 Index) { return (SlotEnum)Index; }
+};
+
+/** 슬롯 enum으로 인덱싱하는 고정 크기 테이블 (해시/힙 없음). 리플렉션이 필요 없는 런타임 상태용 */
+template<typename ValueType, typename SlotEnum, int32 NumSlots = (int32)SlotEnum::Count>
+struct TSkillSlotTable
+{
+    using FIndex = TSkillSlotIndex<SlotEnum, NumSlots>;
+
+    ValueType Items[NumSlots];
+
+    static constexpr int32 Num() { return NumSlots; }
+
+    FORCEINLINE ValueType& operator[](SlotEnum Slot)
+    {
+        check(FIndex::IsValid(Slot));
+        return Items[FIndex::ToIndex(Slot)];
+    }
+
+    FORCEINLINE const ValueType& operator[](SlotEnum Slot) const
+    {
+        check(FIndex::IsValid(Slot));
+        return Items[FIndex::ToIndex(Slot)];
+    }
+
+    FORCEINLINE ValueType* Find(SlotEnum Slot) { return FIndex::IsValid(Slot) ? &Items[FIndex::ToIndex(Slot)] : nullptr; }
+    FORCEINLINE const ValueType* Find(SlotEnum Slot) const { return FIndex::IsValid(Slot) ? &Items[FIndex::ToIndex(Slot)] : nullptr; }
+
+    void Fill(const ValueType& Value)
+    {
+        for (ValueType& Item : Items) Item = Value;
+    }
+
+    ValueType* begin() { return Items; }
+    ValueType* end() { return Items + NumSlots; }
+    const ValueType* begin() const { return Items; }
+    const ValueType* end() const { return Items + NumSlots; }
+};
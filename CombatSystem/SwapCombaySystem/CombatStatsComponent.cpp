@@ -0,0 +1,66 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "CombatStatsComponent.h"
+
+UCombatStatsComponent::UCombatStatsComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UCombatStatsComponent::OnRegister()
+{
+    Super::OnRegister();
+    RecalculateTotals();
+}
+
+void UCombatStatsComponent::RecalculateTotals()
+{
+    DRApplyBaseStats(Stats, BaseStats, Damage, Defense, Resistance, DamageMultiplier);
+    RefreshDerived();
+}
+
+void UCombatStatsComponent::RefreshDerived()
+{
+    if (DerivedVersion == Stats.GetVersion())
+    {
+        return;
+    }
+    DerivedVersion = Stats.GetVersion();
+
+    Stats.BuildLanes(AttackLanes, MitigationLanes);
+
+    float TotalAttack = 0.f;
+    for (float Channel : AttackLanes.V)
+    {
+        TotalAttack += Channel;
+    }
+    Computed.FinalAttack = TotalAttack;
+    Computed.FinalDefense = Stats.Get(EDRStat::DefensePhysical) + Stats.Get(EDRStat::Dexterity) * 1.5f;
+}
+
+FDRStatModifierHandle UCombatStatsComponent::AddStatModifier(const FDRStatModifier& Modifier, UObject* Source)
+{
+    const FDRStatModifierHandle Handle = Stats.AddModifier(Modifier, Source);
+    RefreshDerived();
+    return Handle;
+}
+
+bool UCombatStatsComponent::RemoveStatModifier(FDRStatModifierHandle& Handle)
+{
+    const bool bRemoved = Stats.RemoveModifier(Handle);
+    RefreshDerived();
+    return bRemoved;
+}
+
+int32 UCombatStatsComponent::RemoveStatModifiersFromSource(UObject* Source)
+{
+    const int32 Removed = Stats.RemoveModifiersFromSource(Source);
+    RefreshDerived();
+    return Removed;
+}
+
+float UCombatStatsComponent::ResolveIncoming(const FDRElementLanes& Attack, FDRElementLanes* OutPerChannel) const
+{
+    return DRElemental::ResolveHit(Attack, MitigationLanes, OutPerChannel);
+}
@@ -0,0 +1,72 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "PlayerState.h"
+#include "CombatStatsComponent.generated.h"
+
+/**
+ * PlayerState가 없는 NPC용 스탯 + 수정자 스택.
+ * APlayerState와 같은 FDRStatAggregator/피해 커널 레인을 쓰므로 플레이어↔NPC 피해 계산이 같은 경로를 탄다.
+ * 틱 없음: 수정자 변경 시에만 더티 스탯을 다시 계산.
+ */
+UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
+class DUSKREGION_API UCombatStatsComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UCombatStatsComponent();
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stats")
+    FDRBaseStats BaseStats;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stats")
+    FDRElementalDamage Damage;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stats")
+    FDRElementalDefense Defense;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stats")
+    FDRElementalResistance Resistance;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stats")
+    FDRElementalMultiplier DamageMultiplier;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+    FDRComputedTotals Computed;
+
+    UFUNCTION(BlueprintCallable, Category = "Stats")
+    void RecalculateTotals();
+
+    UFUNCTION(BlueprintCallable, Category = "Stats")
+    FDRStatModifierHandle AddStatModifier(const FDRStatModifier& Modifier, UObject* Source = nullptr);
+
+    UFUNCTION(BlueprintCallable, Category = "Stats")
+    bool RemoveStatModifier(UPARAM(ref) FDRStatModifierHandle& Handle);
+
+    UFUNCTION(BlueprintCallable, Category = "Stats")
+    int32 RemoveStatModifiersFromSource(UObject* Source);
+
+    UFUNCTION(BlueprintPure, Category = "Stats")
+    float GetStat(EDRStat Stat) const { return Stats.Get(Stat); }
+
+    // 외부 피해(플레이어 공격 레인 등)를 이 NPC의 방어로 감쇄
+    float ResolveIncoming(const FDRElementLanes& Attack, FDRElementLanes* OutPerChannel = nullptr) const;
+
+    const FDRStatAggregator& GetStatAggregator() const { return Stats; }
+    const FDRElementLanes& GetAttackLanes() const { return AttackLanes; }
+    const FDRElementLanes& GetMitigationLanes() const { return MitigationLanes; }
+
+protected:
+    virtual void OnRegister() override;
+
+    FDRStatAggregator Stats;
+    uint32 DerivedVersion = MAX_uint32;
+    FDRElementLanes AttackLanes;
+    FDRElementLanes MitigationLanes;
+
+    void RefreshDerived();
+};
@@ -0,0 +1,158 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ElementalDamage.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+namespace DRElemental
+{
+    FDRElementLanes BuildAttack(const FDRElementLanes& Damage, const FDRElementLanes& Multiplier)
+    {
+        FDRElementLanes Out;
+        for (int32 Half = 0; Half < FDRElementLanes::NumChannels; Half += 4)
+        {
+            const VectorRegister4Float D = VectorMax(VectorLoadAligned(Damage.V + Half), GlobalVectorConstants::FloatZero);
+            const VectorRegister4Float M = VectorMax(VectorLoadAligned(Multiplier.V + Half), GlobalVectorConstants::FloatZero);
+            VectorStoreAligned(VectorMultiply(D, M), Out.V + Half);
+        }
+        return Out;
+    }
+
+    FDRElementLanes BuildMitigation(const FDRElementLanes& Defense, const FDRElementLanes& Resistance)
+    {
+        const VectorRegister4Float K = VectorSetFloat1(DefenseConstant);
+        const VectorRegister4Float MinR = VectorSetFloat1(MinResistance);
+        const VectorRegister4Float MaxR = VectorSetFloat1(MaxResistance);
+
+        FDRElementLanes Out;
+        for (int32 Half = 0; Half < FDRElementLanes::NumChannels; Half += 4)
+        {
+            const VectorRegister4Float D = VectorMax(VectorLoadAligned(Defense.V + Half), GlobalVectorConstants::FloatZero);
+            const VectorRegister4Float R = VectorMin(VectorMax(VectorLoadAligned(Resistance.V + Half), MinR), MaxR);
+            const VectorRegister4Float DefenseScale = VectorDivide(K, VectorAdd(K, D));
+            VectorStoreAligned(VectorMultiply(VectorSubtract(GlobalVectorConstants::FloatOne, R), DefenseScale), Out.V + Half);
+        }
+        return Out;
+    }
+
+    float ResolveHit(const FDRElementLanes& Attack, const FDRElementLanes& Mitigation, FDRElementLanes* OutPerChannel)
+    {
+        const VectorRegister4Float Lo = VectorMultiply(VectorLoadAligned(Attack.V), VectorLoadAligned(Mitigation.V));
+        const VectorRegister4Float Hi = VectorMultiply(VectorLoadAligned(Attack.V + 4), VectorLoadAligned(Mitigation.V + 4));
+        if (OutPerChannel)
+        {
+            VectorStoreAligned(Lo, OutPerChannel->V);
+            VectorStoreAligned(Hi, OutPerChannel->V + 4);
+        }
+        return VectorGetComponent(VectorDot4(VectorAdd(Lo, Hi), GlobalVectorConstants::FloatOne), 0);
+    }
+
+    void ResolveHits(const FDRElementLanes& Attack, TArrayView<const FDRElementLanes> Mitigations, TArrayView<float> OutTotals)
+    {
+        check(OutTotals.Num() >= Mitigations.Num());
+
+        // 공격 레인은 대상 전체에 공통 → 레지스터에 한 번만 적재
+        const VectorRegister4Float AtkLo = VectorLoadAligned(Attack.V);
+        const VectorRegister4Float AtkHi = VectorLoadAligned(Attack.V + 4);
+        for (int32 i = 0; i < Mitigations.Num(); ++i)
+        {
+            const FDRElementLanes& M = Mitigations[i];
+            const VectorRegister4Float Sum = VectorMultiplyAdd(AtkLo, VectorLoadAligned(M.V), VectorMultiply(AtkHi, VectorLoadAligned(M.V + 4)));
+            OutTotals[i] = VectorGetComponent(VectorDot4(Sum, GlobalVectorConstants::FloatOne), 0);
+        }
+    }
+
+    float ResolveHitScalar(const FDRElementLanes& Attack, const FDRElementLanes& Mitigation)
+    {
+        float Total = 0.f;
+        for (int32 c = 0; c < FDRElementLanes::NumChannels; ++c)
+        {
+            Total += Attack.V[c] * Mitigation.V[c];
+        }
+        return Total;
+    }
+}
+
+// 같은 사전 계산 방어 레인에 대해 스칼라 ResolveHitScalar vs SIMD ResolveHits 비교.
+// 참고용으로 매 히트마다 방어 곡선을 계산하는 기존 방식(uncached)도 따로 측정 (사전 계산 효과)
+static FAutoConsoleCommand CmdElementalBench(
+    TEXT("DR.Bench.Elemental"),
+    TEXT("DR.Bench.Elemental [Targets=50] [Iterations=20000] : 속성 피해 SIMD 커널과 스칼라 버전의 히트당 비용 비교"),
+    FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+    {
+        const int32 NumTargets = FMath::Max(1, Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 50);
+        const int32 Iterations = FMath::Max(1, Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 20000);
+
+        FRandomStream Rng(1234);
+        auto RandomLanes = [&Rng](float Min, float Max)
+        {
+            FDRElementLanes L;
+            for (float& X : L.V) X = Rng.FRandRange(Min, Max);
+            return L;
+        };
+
+        const FDRElementLanes Attack = DRElemental::BuildAttack(RandomLanes(0.f, 200.f), RandomLanes(0.5f, 2.f));
+        TArray<FDRElementLanes> Defense, Resist, Mitigation;
+        for (int32 t = 0; t < NumTargets; ++t)
+        {
+            Defense.Add(RandomLanes(0.f, 300.f));
+            Resist.Add(RandomLanes(-0.5f, 0.9f));
+            Mitigation.Add(DRElemental::BuildMitigation(Defense.Last(), Resist.Last()));
+        }
+        TArray<float> Totals, ScalarTotals;
+        Totals.SetNumZeroed(NumTargets);
+        ScalarTotals.SetNumZeroed(NumTargets);
+        double Checksum = 0.0;
+
+        // 기존 방식: 매 히트마다 채널별 곡선(나눗셈 포함)을 직접 계산
+        const double UncachedStart = FPlatformTime::Seconds();
+        for (int32 It = 0; It < Iterations; ++It)
+        {
+            for (int32 t = 0; t < NumTargets; ++t)
+            {
+                float Total = 0.f;
+                for (int32 c = 0; c < FDRElementLanes::NumChannels; ++c)
+                {
+                    const float R = FMath::Clamp(Resist[t].V[c], DRElemental::MinResistance, DRElemental::MaxResistance);
+                    const float D = FMath::Max(0.f, Defense[t].V[c]);
+                    Total += Attack.V[c] * (1.f - R) * DRElemental::DefenseConstant / (DRElemental::DefenseConstant + D);
+                }
+                Totals[t] = Total;
+            }
+            Checksum += Totals[It % NumTargets];
+        }
+        const double UncachedSec = FPlatformTime::Seconds() - UncachedStart;
+
+        // 스칼라: SIMD 경로와 같은 Mitigation 배열
+        const double ScalarStart = FPlatformTime::Seconds();
+        for (int32 It = 0; It < Iterations; ++It)
+        {
+            for (int32 t = 0; t < NumTargets; ++t)
+            {
+                ScalarTotals[t] = DRElemental::ResolveHitScalar(Attack, Mitigation[t]);
+            }
+            Checksum += ScalarTotals[It % NumTargets];
+        }
+        const double ScalarSec = FPlatformTime::Seconds() - ScalarStart;
+
+        const double SimdStart = FPlatformTime::Seconds();
+        for (int32 It = 0; It < Iterations; ++It)
+        {
+            DRElemental::ResolveHits(Attack, Mitigation, Totals);
+            Checksum -= Totals[It % NumTargets];
+        }
+        const double SimdSec = FPlatformTime::Seconds() - SimdStart;
+
+        float MaxError = 0.f;
+        for (int32 t = 0; t < NumTargets; ++t)
+        {
+            MaxError = FMath::Max(MaxError, FMath::Abs(Totals[t] - ScalarTotals[t]));
+        }
+
+        const double Hits = (double)NumTargets * Iterations;
+        UE_LOG(LogTemp, Log, TEXT("ElementalBench %d targets x %d: scalar %.2f ns/hit, simd %.2f ns/hit (x%.2f), uncached %.2f ns/hit, max error %g, checksum %g"),
+            NumTargets, Iterations, ScalarSec * 1e9 / Hits, SimdSec * 1e9 / Hits, ScalarSec / FMath::Max(SimdSec, 1e-9),
+            UncachedSec * 1e9 / Hits, MaxError, Checksum);
+    }));
@@ -0,0 +1,58 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/VectorRegister.h"
+// 채널 순서는 PlayerState.h의 속성 구조체들과 같다 (여기서는 포함하지 않음: PlayerState.h가 이 헤더를 포함)
+
+/**
+ * 8개 속성 채널(Physical, Magical, Fire, Ice, Wind, Ground, Dark, Holy)을 16바이트 정렬 레인으로 담은 값.
+ * 채널 순서는 FDRElementalDamage/Defense/Resistance/Multiplier 필드 순서와 같다. 레지스터 2개로 처리.
+ */
+struct alignas(16) FDRElementLanes
+{
+    static constexpr int32 NumChannels = 8;
+
+    float V[NumChannels] = {};
+
+    template<typename ElementalStruct>
+    static FDRElementLanes From(const ElementalStruct& S)
+    {
+        static_assert(sizeof(ElementalStruct) == sizeof(float) * NumChannels, "Elemental struct must be exactly 8 packed floats");
+        FDRElementLanes Out;
+        FMemory::Memcpy(Out.V, &S, sizeof(Out.V));
+        return Out;
+    }
+
+    template<typename ElementalStruct>
+    void To(ElementalStruct& S) const
+    {
+        static_assert(sizeof(ElementalStruct) == sizeof(float) * NumChannels, "Elemental struct must be exactly 8 packed floats");
+        FMemory::Memcpy(&S, V, sizeof(V));
+    }
+};
+
+namespace DRElemental
+{
+    // 방어 체감 상수: 방어 D일 때 피해 배율 K / (K + D)
+    constexpr float DefenseConstant = 100.f;
+    // 저항 범위: 음수는 약점(추가 피해), 상한 90%
+    constexpr float MinResistance = -1.f;
+    constexpr float MaxResistance = 0.9f;
+
+    /** 공격 레인 = 채널 피해 × 채널 배율 */
+    DUSKREGION_API FDRElementLanes BuildAttack(const FDRElementLanes& Damage, const FDRElementLanes& Multiplier);
+
+    /** 방어 레인 = (1 - 저항) × K / (K + 방어). 대상 스탯이 바뀔 때만 다시 계산 */
+    DUSKREGION_API FDRElementLanes BuildMitigation(const FDRElementLanes& Defense, const FDRElementLanes& Resistance);
+
+    /** 히트 하나: 채널별 공격 × 방어의 합. OutPerChannel이 있으면 채널별 결과도 기록 */
+    DUSKREGION_API float ResolveHit(const FDRElementLanes& Attack, const FDRElementLanes& Mitigation, FDRElementLanes* OutPerChannel = nullptr);
+
+    /** 한 공격으로 여러 대상(광역 스킬) 처리. OutTotals는 Mitigations와 같은 길이 */
+    DUSKREGION_API void ResolveHits(const FDRElementLanes& Attack, TArrayView<const FDRElementLanes> Mitigations, TArrayView<float> OutTotals);
+
+    /** 비교/검증용 스칼라 버전 (DR.Bench.Elemental) */
+    DUSKREGION_API float ResolveHitScalar(const FDRElementLanes& Attack, const FDRElementLanes& Mitigation);
+}
@@ -0,0 +1,253 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "PartyAssistScheduler.h"
+#include "DRPartyComponent.h"
+#include "CombatStats.h"
+#include "MeeleAttackComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarPartyAssistMaxPawns(
+    TEXT("Party.Assist.MaxPawns"),
+    8,
+    TEXT("월드 전체 동시 어시스트 폰 수 상한 (초과 시 가장 먼저 끝날 어시스트를 조기 종료)"));
+
+static TAutoConsoleVariable<int32> CVarPartyAssistFullRatePawns(
+    TEXT("Party.Assist.FullRatePawns"),
+    4,
+    TEXT("풀 레이트로 틱하는 어시스트 폰 수 예산. 초과하면 모든 어시스트 폰의 틱 간격을 ceil(N / 예산)배로"));
+
+static TAutoConsoleVariable<float> CVarPartyAssistBaseTickHz(
+    TEXT("Party.Assist.BaseTickHz"),
+    60.f,
+    TEXT("예산 초과 시 틱 간격 계산 기준 주파수"));
+
+static TAutoConsoleVariable<float> CVarPartyAssistMinTime(
+    TEXT("Party.Assist.MinTime"),
+    0.25f,
+    TEXT("공격이 끝나도 어시스트를 유지하는 최소 시간(초). 이후 공격이 Idle이면 창 만료 전에 조기 종료"));
+
+bool UPartyAssistScheduler::RequestAssist(PartyCombatComponent* Party, APawn* Pawn, float Window, int32 MaxSimulatedPawns)
+{
+    UWorld* World = GetWorld();
+    if (!World || !Party || !Pawn || Window <= 0.f) return false;
+
+    // 활성 폰 1개 + 어시스트
+    const int32 PartyCap = MaxSimulatedPawns - 1;
+    if (PartyCap <= 0) return false;
+
+    CancelAssist(Pawn);
+
+    int32 PartyCount = 0;
+    for (const FAssist& A : Assists)
+    {
+        PartyCount += (A.Party.Get() == Party) ? 1 : 0;
+    }
+    if (PartyCount >= PartyCap)
+    {
+        EndAssistAt(FindEarliestEnding(Party), true);
+    }
+
+    const int32 WorldCap = FMath::Max(1, CVarPartyAssistMaxPawns.GetValueOnGameThread());
+    if (Assists.Num() >= WorldCap)
+    {
+        EndAssistAt(FindEarliestEnding(nullptr), true);
+    }
+
+    FAssist& A = Assists.AddDefaulted_GetRef();
+    A.Party = Party;
+    A.Pawn = Pawn;
+    A.StartTime = World->GetTimeSeconds();
+    A.EndTime = A.StartTime + Window;
+
+    ApplyTickBudget();
+    return true;
+}
+
+void UPartyAssistScheduler::CancelAssist(APawn* Pawn)
+{
+    const int32 Index = Assists.IndexOfByPredicate([Pawn](const FAssist& A) { return A.Pawn.Get() == Pawn; });
+    if (Index != INDEX_NONE)
+    {
+        EndAssistAt(Index, false);
+        ApplyTickBudget();
+    }
+}
+
+void UPartyAssistScheduler::CancelAll(PartyCombatComponent* Party)
+{
+    for (int32 i = Assists.Num() - 1; i >= 0; --i)
+    {
+        if (Assists[i].Party.Get() == Party)
+        {
+            EndAssistAt(i, false);
+        }
+    }
+    ApplyTickBudget();
+}
+
+bool UPartyAssistScheduler::IsAssisting(const APawn* Pawn) const
+{
+    return Assists.ContainsByPredicate([Pawn](const FAssist& A) { return A.Pawn.Get() == Pawn; });
+}
+
+int32 UPartyAssistScheduler::FindEarliestEnding(const PartyCombatComponent* Party) const
+{
+    int32 Best = INDEX_NONE;
+    for (int32 i = 0; i < Assists.Num(); ++i)
+    {
+        if (Party && Assists[i].Party.Get() != Party) continue;
+        if (Best == INDEX_NONE || Assists[i].EndTime < Assists[Best].EndTime) Best = i;
+    }
+    return Best;
+}
+
+void UPartyAssistScheduler::EndAssistAt(int32 Index, bool bNotify)
+{
+    if (!Assists.IsValidIndex(Index)) return;
+
+    // 콜백 중 재진입(RequestAssist/Cancel)에 대비해 먼저 목록에서 뺀다
+    FAssist A = MoveTemp(Assists[Index]);
+    Assists.RemoveAtSwap(Index);
+
+    RestoreTickIntervals(A);
+
+    if (bNotify)
+    {
+        PartyCombatComponent* Party = A.Party.Get();
+        APawn* Pawn = A.Pawn.Get();
+        if (Party && Pawn)
+        {
+            Party->OnAssistFinished(Pawn);
+        }
+    }
+}
+
+void UPartyAssistScheduler::Tick(float DeltaTime)
+{
+    COMBAT_SCOPE(STAT_CombatPartyAssistScheduler);
+
+    const UWorld* World = GetWorld();
+    if (!World) return;
+    const float Now = World->GetTimeSeconds();
+    const float MinTime = CVarPartyAssistMinTime.GetValueOnGameThread();
+
+    bool bChanged = false;
+    for (int32 i = Assists.Num() - 1; i >= 0; --i)
+    {
+        const FAssist& A = Assists[i];
+        APawn* Pawn = A.Pawn.Get();
+        if (!Pawn || !A.Party.IsValid())
+        {
+            EndAssistAt(i, false);
+            bChanged = true;
+            continue;
+        }
+
+        // 창 만료, 또는 최소 시간 이후 진행 중 공격이 없으면 조기 종료
+        bool bDone = Now >= A.EndTime;
+        if (!bDone && Now - A.StartTime >= MinTime)
+        {
+            const UMeeleAttackComponent* Melee = Pawn->FindComponentByClass<UMeeleAttackComponent>();
+            bDone = !Melee || !Melee->IsBusy();
+        }
+
+        if (bDone)
+        {
+            EndAssistAt(i, true);
+            bChanged = true;
+        }
+    }
+
+    if (bChanged)
+    {
+        ApplyTickBudget();
+    }
+
+    SET_DWORD_STAT(STAT_CombatPartyAssistPawns, Assists.Num());
+    SET_DWORD_STAT(STAT_CombatPartyAssistThrottled, AppliedStride > 1 ? Assists.Num() : 0);
+}
+
+TStatId UPartyAssistScheduler::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UPartyAssistScheduler, STATGROUP_Tickables);
+}
+
+void UPartyAssistScheduler::ApplyTickBudget()
+{
+    const int32 Budget = FMath::Max(1, CVarPartyAssistFullRatePawns.GetValueOnGameThread());
+    const int32 Stride = FMath::Max(1, FMath::DivideAndRoundUp(Assists.Num(), Budget));
+    const float BaseHz = FMath::Max(1.f, CVarPartyAssistBaseTickHz.GetValueOnGameThread());
+
+    AppliedStride = Stride;
+    for (FAssist& A : Assists)
+    {
+        if (Stride <= 1)
+        {
+            RestoreTickIntervals(A);
+        }
+        else
+        {
+            // N개가 Stride배 간격으로 틱 → 초당 틱 수 ≈ 예산 × BaseHz
+            SetAssistTickInterval(A, Stride / BaseHz);
+        }
+    }
+}
+
+void UPartyAssistScheduler::SetAssistTickInterval(FAssist& Assist, float Interval)
+{
+    APawn* Pawn = Assist.Pawn.Get();
+    if (!Pawn) return;
+
+    if (Assist.SavedIntervals.Num() == 0)
+    {
+        // 폰 + 부착 액터(무기/이펙트 액터) 전체를 재귀로 (DeactivatePawn과 같은 범위)
+        TArray<AActor*> Actors;
+        Actors.Add(Pawn);
+        Pawn->GetAttachedActors(Actors, false, true);
+
+        for (AActor* Actor : Actors)
+        {
+            Assist.SavedIntervals.Add({ Actor, Actor->GetActorTickInterval() });
+            Actor->ForEachComponent<UActorComponent>(false, [&Assist](UActorComponent* Comp)
+            {
+                if (Comp->PrimaryComponentTick.bCanEverTick)
+                {
+                    Assist.SavedIntervals.Add({ Comp, Comp->GetComponentTickInterval() });
+                }
+            });
+        }
+    }
+
+    for (const FTickSave& Save : Assist.SavedIntervals)
+    {
+        // 원래 더 긴 간격을 쓰던 대상은 그대로
+        const float NewInterval = FMath::Max(Save.Interval, Interval);
+        if (AActor* Actor = Cast<AActor>(Save.Target.Get()))
+        {
+            Actor->SetActorTickInterval(NewInterval);
+        }
+        else if (UActorComponent* Comp = Cast<UActorComponent>(Save.Target.Get()))
+        {
+            Comp->SetComponentTickInterval(NewInterval);
+        }
+    }
+}
+
+void UPartyAssistScheduler::RestoreTickIntervals(FAssist& Assist)
+{
+    for (const FTickSave& Save : Assist.SavedIntervals)
+    {
+        if (AActor* Actor = Cast<AActor>(Save.Target.Get()))
+        {
+            Actor->SetActorTickInterval(Save.Interval);
+        }
+        else if (UActorComponent* Comp = Cast<UActorComponent>(Save.Target.Get()))
+        {
+            Comp->SetComponentTickInterval(Save.Interval);
+        }
+    }
+    Assist.SavedIntervals.Reset();
+}
@@ -0,0 +1,70 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PartyAssistScheduler.generated.h"
+
+class PartyCombatComponent;
+class APawn;
+
+/**
+ * 스왑 어시스트(나간 멤버가 AI로 잠시 계속 싸우는 상태) 스케줄러 (월드 단위).
+ * - 파티별 동시 시뮬레이션 폰 수(PartyCombatComponent::MaxSimulatedPawns)와 월드 전체 어시스트 수(Party.Assist.MaxPawns)를 제한.
+ *   한도에 걸리면 가장 먼저 끝날 어시스트를 조기 종료.
+ * - 틱 예산(Party.Assist.FullRatePawns): 초과 시 어시스트 폰 전체의 틱 간격을 늘려 초당 틱 수를 예산 안으로.
+ *   예산 재계산은 어시스트 수가 바뀔 때만.
+ * - 창 만료 또는 (최소 시간 이후) 공격이 끝나면 파티에 종료 통지 → 휴면.
+ */
+UCLASS()
+class DUSKREGION_API UPartyAssistScheduler : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** 어시스트 등록. 한도 초과 시 다른 어시스트를 밀어내며, 파티 한도가 1 이하면 false */
+    bool RequestAssist(PartyCombatComponent* Party, APawn* Pawn, float Window, int32 MaxSimulatedPawns);
+
+    /** 콜백 없이 제거 (플레이어가 어시스트 중인 멤버로 되돌아온 경우 등) */
+    void CancelAssist(APawn* Pawn);
+
+    /** 파티의 어시스트 전부 제거 (EndPlay) */
+    void CancelAll(PartyCombatComponent* Party);
+
+    bool IsAssisting(const APawn* Pawn) const;
+    int32 GetNumAssists() const { return Assists.Num(); }
+
+    // FTickableGameObject
+    virtual void Tick(float DeltaTime) override;
+    virtual bool IsTickable() const override { return Assists.Num() > 0; }
+    virtual TStatId GetStatId() const override;
+
+private:
+    struct FTickSave
+    {
+        TWeakObjectPtr<UObject> Target; // AActor 또는 UActorComponent
+        float Interval = 0.f;
+    };
+
+    struct FAssist
+    {
+        TWeakObjectPtr<PartyCombatComponent> Party;
+        TWeakObjectPtr<APawn> Pawn;
+        float StartTime = 0.f;
+        float EndTime = 0.f;
+        TArray<FTickSave> SavedIntervals; // 예산 적용 전 틱 간격
+    };
+
+    TArray<FAssist> Assists;
+    int32 AppliedStride = 1;
+
+    // Index 어시스트 종료. bNotify면 파티가 폰을 휴면시킨다
+    void EndAssistAt(int32 Index, bool bNotify);
+    int32 FindEarliestEnding(const PartyCombatComponent* Party) const;
+
+    // 예산 재적용 (어시스트 수 변경 시)
+    void ApplyTickBudget();
+    void SetAssistTickInterval(FAssist& Assist, float Interval);
+    void RestoreTickIntervals(FAssist& Assist);
+};
@@ -4,12 +4,49 @@
 #include "DRPartyComponent.h"
 #include "GameFramework/PlayerController.h"
 #include "Kismet/GameplayStatics.h"
+#include "Engine/AssetManager.h"
 #include "BaseCharacter.h"
+#include "MeeleAttackComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectIterator.h"
+#include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
+#include "PartyAssistScheduler.h"
+#include "AIController.h"
+#include "BehaviorTree/BehaviorTree.h"
+
+static FAutoConsoleCommandWithWorld CmdPartyDump(
+    TEXT("Party.Dump"),
+    TEXT("파티 폰별 틱 중인 액터/컴포넌트, 물리 바디, 넷 휴면 상태 출력 (휴면 멤버는 모두 0이어야 함)"),
+    FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+    {
+        for (TObjectIterator<PartyCombatComponent> It; It; ++It)
+        {
+            if (It->GetWorld() == World)
+            {
+                It->DumpPawnCosts();
+            }
+        }
+    }));
 
 
 PartyCombatComponent::PartyCombatComponent()
 {
     PrimaryComponentTick.bCanEverTick = false;
+    SetIsReplicatedByDefault(true);
+}
+
+void PartyCombatComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+    // PlayerController 소유라 소유 클라이언트에만 간다. 스왑/스폰 시에만 더티
+    FDoRepLifetimeParams Params;
+    Params.bIsPushBased = true;
+    DOREPLIFETIME_WITH_PARAMS_FAST(PartyCombatComponent, ActiveIndex, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(PartyCombatComponent, PartyPawns, Params);
 }
 
 APlayerController* PartyCombatComponent::GetPC() const
@@ -19,26 +56,123 @@ APlayerController* PartyCombatComponent::GetPC() const
 
 void PartyCombatComponent::InitializeParty()
 {
-    // 미리 스폰(풀링). 모두 숨김 상태로 대기.
+    // 미리 스폰(풀링). 로드된 클래스는 바로, 나머지는 비동기 로드 후 숨김 상태로 스폰.
+    // 클라이언트는 스폰하지 않고 클래스만 프리로드 (복제된 폰이 들어올 때 동기 로드 방지)
+    const int32 StartIndex = ActiveIndex != INDEX_NONE ? ActiveIndex : 0;
     for (int32 i = 0; i < PartySlots.Num(); ++i)
     {
-        if (!PartySlots[i].SpawnedPawn.IsValid())
-            SpawnIfNeeded(i);
+        if (SpawnIfNeeded(i))
+            continue;
+
+        // 첫 캐릭터 > 다음 스왑 후보 > 나머지
+        int32 Priority = FStreamableManager::DefaultAsyncLoadPriority;
+        if (i == StartIndex)
+            Priority = FStreamableManager::AsyncLoadHighPriority;
+        else if (i == (StartIndex + 1) % PartySlots.Num())
+            Priority = FStreamableManager::AsyncLoadHighPriority - 1;
+
+        RequestSlotLoad(i, Priority);
+    }
+
+    // 시작 캐릭터 선택(없으면 0번). 아직 로드 중이면 완료 시 자동 스왑
+    if (GetOwnerRole() == ROLE_Authority && ActiveIndex == INDEX_NONE && PartySlots.Num() > 0)
+    {
+        ExecuteSwap(0);
+    }
+}
 
-        if (auto* P = PartySlots[i].SpawnedPawn.Get())
+void PartyCombatComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    for (FPartySlot& Slot : PartySlots)
+    {
+        if (Slot.LoadHandle.IsValid())
+        {
+            Slot.LoadHandle->CancelHandle();
+            Slot.LoadHandle.Reset();
+        }
+    }
+    PendingSwapIndex = INDEX_NONE;
+    DormantStates.Empty();
+
+    if (UWorld* World = GetWorld())
+    {
+        if (UPartyAssistScheduler* Scheduler = World->GetSubsystem<UPartyAssistScheduler>())
         {
-            // 풀링 초기화: 숨김/충돌OFF/틱OFF
-            P->SetActorHiddenInGame(true);
-            P->SetActorEnableCollision(false);
-            P->SetActorTickEnabled(false);
+            // 아직 어시스트 중인 폰의 AI 컨트롤러는 해제 후 파괴 (CancelAll은 파티에 통지하지 않음)
+            for (const FPartySlot& Slot : PartySlots)
+            {
+                APawn* Pawn = Cast<APawn>(Slot.SpawnedPawn.Get());
+                if (!Pawn || !Scheduler->IsAssisting(Pawn)) continue;
+
+                if (AAIController* AI = Cast<AAIController>(Pawn->GetController()))
+                {
+                    AI->UnPossess();
+                    AI->Destroy();
+                }
+            }
+            Scheduler->CancelAll(this);
         }
     }
 
-    // 시작 캐릭터 선택(없으면 0번)
-    if (ActiveIndex == INDEX_NONE && PartySlots.Num() > 0)
+    // 풀에 남은 어시스트 컨트롤러도 컴포넌트와 함께 정리
+    for (AAIController* AI : IdleAssistControllers)
     {
-        SwapTo(0);
+        if (IsValid(AI)) AI->Destroy();
     }
+    IdleAssistControllers.Reset();
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void PartyCombatComponent::RequestSlotLoad(int32 SlotIndex, int32 Priority)
+{
+    if (!PartySlots.IsValidIndex(SlotIndex)) return;
+    FPartySlot& Slot = PartySlots[SlotIndex];
+    if (Slot.CharacterClass.IsNull() || Slot.SpawnedPawn.IsValid()) return;
+
+    const bool bLoading = Slot.LoadHandle.IsValid() && Slot.LoadHandle->IsLoadingInProgress();
+    if (bLoading && Priority <= Slot.LoadPriority) return;
+
+    // 우선순위 상향: 같은 경로로 새 요청을 올리고 이전 핸들은 콜백만 해제 (진행 중인 패키지 로드는 이어받음)
+    TSharedPtr<FStreamableHandle> Prev = Slot.LoadHandle;
+    Slot.LoadPriority = Priority;
+    Slot.LoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+        Slot.CharacterClass.ToSoftObjectPath(),
+        FStreamableDelegate::CreateUObject(this, &PartyCombatComponent::OnSlotLoaded, SlotIndex),
+        Priority);
+
+    if (Prev.IsValid() && Prev != Slot.LoadHandle)
+        Prev->CancelHandle();
+}
+
+void PartyCombatComponent::OnSlotLoaded(int32 SlotIndex)
+{
+    if (!PartySlots.IsValidIndex(SlotIndex)) return;
+    if (GetOwnerRole() != ROLE_Authority) return; // 클라이언트는 클래스 상주만 목적
+
+    if (!SpawnIfNeeded(SlotIndex))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Party slot %d: failed to load %s"), SlotIndex, *PartySlots[SlotIndex].CharacterClass.ToString());
+        if (PendingSwapIndex == SlotIndex)
+            PendingSwapIndex = INDEX_NONE;
+        return;
+    }
+
+    OnPartySlotReady.Broadcast(SlotIndex);
+
+    if (PendingSwapIndex == SlotIndex)
+        ExecuteSwap(SlotIndex);
+}
+
+void PartyCombatComponent::PrioritizeNextSwap()
+{
+    if (ActiveIndex == INDEX_NONE || PartySlots.Num() < 2) return;
+    RequestSlotLoad((ActiveIndex + 1) % PartySlots.Num(), FStreamableManager::AsyncLoadHighPriority - 1);
+}
+
+bool PartyCombatComponent::IsSlotReady(int32 SlotIndex) const
+{
+    return PartySlots.IsValidIndex(SlotIndex) && PartySlots[SlotIndex].SpawnedPawn.IsValid();
 }
 
 ABaseCharacter* PartyCombatComponent::SpawnIfNeeded(int32 SlotIndex)
@@ -47,62 +181,404 @@ ABaseCharacter* PartyCombatComponent::SpawnIfNeeded(int32 SlotIndex)
     if (PartySlots[SlotIndex].SpawnedPawn.IsValid())
         return PartySlots[SlotIndex].SpawnedPawn.Get();
 
-//    UClass* Cls = PartySlots[SlotIndex].CharacterClass.LoadSynchronous();
-    UClass* Cls = nullptr;
-    if (!Cls) return nullptr;
+    // 스폰은 서버만 (클라이언트는 PartyPawns 복제로 받음)
+    if (GetOwnerRole() != ROLE_Authority) return nullptr;
 
-    FActorSpawnParameters Params;
-    Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    // 동기 로드 금지: 로드 안 된 클래스는 nullptr → 호출 측이 RequestSlotLoad
+    UClass* Cls = PartySlots[SlotIndex].CharacterClass.Get();
+    if (!Cls) return nullptr;
 
     UWorld* World = GetWorld();
     if (!World) return nullptr;
 
-    // 초기는 월드 원점에 스폰, 실제 전환 시 위치 스냅
-    auto* NewC = World->SpawnActor<ABaseCharacter>(Cls, FTransform::Identity, Params);
+    // 초기는 월드 원점에 스폰, 실제 전환 시 위치 스냅.
+    // 지연 스폰으로 BeginPlay 전에 풀링 상태(숨김/충돌OFF/틱OFF)를 적용 → 한 프레임도 보이지 않음
+    auto* NewC = World->SpawnActorDeferred<ABaseCharacter>(Cls, FTransform::Identity, nullptr, nullptr,
+        ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+    if (!NewC) return nullptr;
+
+    NewC->SetActorHiddenInGame(true);
+    NewC->SetActorEnableCollision(false);
+    NewC->FinishSpawning(FTransform::Identity);
+
+    // 컴포넌트 틱/물리 상태는 등록 후에 확정되므로 휴면 처리는 스폰 완료 뒤
+    DeactivatePawn(NewC);
+
     PartySlots[SlotIndex].SpawnedPawn = NewC;
+
+    if (PartyPawns.Num() < PartySlots.Num())
+        PartyPawns.SetNum(PartySlots.Num());
+    PartyPawns[SlotIndex] = NewC;
+    MARK_PROPERTY_DIRTY_FROM_NAME(PartyCombatComponent, PartyPawns, this);
     return NewC;
 }
 
+namespace
+{
+    // 스왑 시 나가는 폰에서 들어오는 폰으로 넘기는 상태
+    struct FPartySwapCarry
+    {
+        FVector Velocity = FVector::ZeroVector;
+        TEnumAsByte<EMovementMode> MovementMode = MOVE_None;
+        int32 ComboIndex = INDEX_NONE;
+    };
+
+    FPartySwapCarry CaptureCarry(const ABaseCharacter* From)
+    {
+        FPartySwapCarry Carry;
+        if (!From) return Carry;
+        if (const UCharacterMovementComponent* Move = From->FindComponentByClass<UCharacterMovementComponent>())
+        {
+            Carry.Velocity = Move->Velocity;
+            Carry.MovementMode = Move->MovementMode;
+        }
+        if (const UMeeleAttackComponent* Melee = From->FindComponentByClass<UMeeleAttackComponent>())
+        {
+            Carry.ComboIndex = Melee->GetComboContinuation();
+        }
+        return Carry;
+    }
+}
+
+bool PartyCombatComponent::IsSwapOnCooldown() const
+{
+    const UWorld* World = GetWorld();
+    return World && ActiveIndex != INDEX_NONE && World->GetTimeSeconds() - LastSwapTime < SwapCooldown;
+}
+
 void PartyCombatComponent::SwapTo(int32 SlotIndex)
 {
     if (!PartySlots.IsValidIndex(SlotIndex)) return;
-    if (ActiveIndex == SlotIndex) return;
+
+    if (GetOwnerRole() == ROLE_Authority)
+    {
+        // 리슨 서버 호스트/서버 로직
+        if (SlotIndex != ActiveIndex && IsSwapOnCooldown()) return;
+        ExecuteSwap(SlotIndex);
+        return;
+    }
+
+    if (GetOwnerRole() != ROLE_AutonomousProxy) return;
+
+    // 소유 클라이언트: 한 번에 하나만 예측, 판정은 서버
+    if (PredictedSwap.IsValid() || SlotIndex == ActiveIndex || IsSwapOnCooldown()) return;
+
+    const uint8 Seq = ++LocalSwapSeq;
+    PredictSwap(SlotIndex, Seq);
+    ServerSwapTo((uint8)SlotIndex, Seq);
+}
+
+void PartyCombatComponent::ServerSwapTo_Implementation(uint8 SlotIndex, uint8 InputSeq)
+{
+    if (!PartySlots.IsValidIndex(SlotIndex) || SlotIndex == ActiveIndex || IsSwapOnCooldown())
+    {
+        ClientRejectSwap(InputSeq);
+        return;
+    }
+
+    int32 CarriedCombo = INDEX_NONE;
+    if (!ExecuteSwap(SlotIndex, &CarriedCombo))
+    {
+        // 로드 중 → 서버 큐잉. 예측은 되돌리고 실제 전환은 완료 시 ActiveIndex 복제로 반영
+        ClientRejectSwap(InputSeq);
+        return;
+    }
+
+    ClientConfirmSwap(InputSeq, (int8)FMath::Clamp(CarriedCombo, -1, 127));
+}
+
+bool PartyCombatComponent::ExecuteSwap(int32 SlotIndex, int32* OutCarriedCombo)
+{
+    if (!PartySlots.IsValidIndex(SlotIndex)) return false;
+    if (ActiveIndex == SlotIndex)
+    {
+        // 로드 대기 중 원래 슬롯으로 되돌린 경우 큐 취소
+        PendingSwapIndex = INDEX_NONE;
+        return false;
+    }
 
     APlayerController* PC = GetPC();
-    if (!PC) return;
+    if (!PC) return false;
 
     ABaseCharacter* OldPawn = Cast<ABaseCharacter>(PC->GetPawn());
     ABaseCharacter* NewPawn = SpawnIfNeeded(SlotIndex);
-    if (!NewPawn) return;
+    if (!NewPawn)
+    {
+        // 로드 중: 현재 폰 유지, 요청은 큐잉(마지막 요청 우선)하고 해당 슬롯을 최우선 로드
+        PendingSwapIndex = SlotIndex;
+        RequestSlotLoad(SlotIndex, FStreamableManager::AsyncLoadHighPriority);
+        return false;
+    }
+    PendingSwapIndex = INDEX_NONE;
 
-    // 위치/회전/속도 스냅(기존 폰이 있으면 그 위치로)
-    if (OldPawn)
+    // 어시스트 중인 멤버로 되돌아온 경우: AI에서 회수 (이미 활성 상태, 현재 위치 유지)
+    UPartyAssistScheduler* Scheduler = GetWorld() ? GetWorld()->GetSubsystem<UPartyAssistScheduler>() : nullptr;
+    const bool bReturningFromAssist = Scheduler && Scheduler->IsAssisting(NewPawn);
+    if (bReturningFromAssist)
     {
-        NewPawn->SetActorTransform(OldPawn->GetActorTransform());
-        // 필요시 이동컴포넌트 속도도 스냅 가능
-        // if (auto* MC = OldPawn->GetCharacterMovement()) { ... }
+        Scheduler->CancelAssist(NewPawn);
+        ReleaseAssist(NewPawn);
     }
 
-    // 먼저 이전 폰 비활성
+    // 위치/회전 스냅(기존 폰이 있으면 그 위치로). 속도/콤보는 휴면 처리 전에 캡처
+    FPartySwapCarry Carry;
     if (OldPawn)
+    {
+        if (!bReturningFromAssist)
+            NewPawn->SetActorTransform(OldPawn->GetActorTransform());
+        Carry = CaptureCarry(OldPawn);
+    }
+
+    // 먼저 이전 폰 비활성 (어시스트 모드면 Possess 교체 후 AI에 넘김)
+    const bool bTryAssist = OldPawn && bEnableSwapAssist && MaxSimulatedPawns > 1;
+    if (OldPawn && !bTryAssist)
         DeactivatePawn(OldPawn);
 
-    // Possess 교체
+    // 새 폰 활성화(넷 휴면 해제) 후 Possess 교체 → 빙의 변경이 바로 복제
+    ActivatePawn(NewPawn, OldPawn);
     PC->Possess(NewPawn);
 
-    // 새 폰 활성화
-    ActivatePawn(NewPawn, OldPawn);
+    // 어시스트: 나간 멤버가 진행 중 콤보를 직접 마무리 → 콤보 인계는 하지 않음
+    bool bAssisting = false;
+    if (bTryAssist)
+    {
+        bAssisting = BeginAssist(OldPawn, NewPawn);
+        if (!bAssisting)
+            DeactivatePawn(OldPawn);
+    }
+
+    // 이동 상태 인계: 공중/대시 중 스왑해도 궤적 유지
+    if (UCharacterMovementComponent* Move = NewPawn->FindComponentByClass<UCharacterMovementComponent>())
+    {
+        if (Carry.MovementMode != MOVE_None)
+            Move->SetMovementMode(Carry.MovementMode);
+        Move->Velocity = Carry.Velocity;
+    }
+
+    int32 CarriedCombo = INDEX_NONE;
+    if (bTransferCombo && !bAssisting && Carry.ComboIndex != INDEX_NONE)
+    {
+        if (UMeeleAttackComponent* Melee = NewPawn->FindComponentByClass<UMeeleAttackComponent>())
+        {
+            Melee->CarryCombo(Carry.ComboIndex, ComboCarryWindow);
+            CarriedCombo = Carry.ComboIndex;
+        }
+    }
+    if (OutCarriedCombo) *OutCarriedCombo = CarriedCombo;
 
     ActiveIndex = SlotIndex;
+    MARK_PROPERTY_DIRTY_FROM_NAME(PartyCombatComponent, ActiveIndex, this);
+    if (const UWorld* World = GetWorld())
+        LastSwapTime = World->GetTimeSeconds();
+
+    OnActiveChanged.Broadcast(ActiveIndex);
+    PrioritizeNextSwap();
+    return true;
+}
+
+void PartyCombatComponent::PredictSwap(int32 SlotIndex, uint8 InputSeq)
+{
+    APlayerController* PC = GetPC();
+    ABaseCharacter* OldPawn = PC ? Cast<ABaseCharacter>(PC->GetPawn()) : nullptr;
+    ABaseCharacter* NewPawn = PartySlots[SlotIndex].SpawnedPawn.Get();
+
+    PredictedSwap = FPartySwapPrediction();
+    PredictedSwap.InputSeq = InputSeq;
+    PredictedSwap.ToIndex = SlotIndex;
+
+    if (const UWorld* World = GetWorld())
+        LastSwapTime = World->GetTimeSeconds();
+
+    // 휴면 폰이 아직 복제되지 않았으면 표시 예측 없이 서버 결과만 기다림
+    if (!PC || !NewPawn) return;
+
+    PredictedSwap.FromPawn = OldPawn;
+    PredictedSwap.ToPawn = NewPawn;
+
+    // 표시/카메라만 전환. 빙의/이동은 서버 확정 후 복제로 맞춰진다 (어시스트 모드면 나간 멤버는 계속 보임)
+    if (OldPawn)
+    {
+        NewPawn->SetActorTransform(OldPawn->GetActorTransform());
+        if (!bEnableSwapAssist)
+            OldPawn->SetActorHiddenInGame(true);
+    }
+    NewPawn->SetActorHiddenInGame(false);
+    PC->SetViewTarget(NewPawn);
+}
+
+void PartyCombatComponent::RevertPredictedSwap()
+{
+    APlayerController* PC = GetPC();
+    if (AActor* ToPawn = PredictedSwap.ToPawn.Get())
+        ToPawn->SetActorHiddenInGame(true);
+    if (AActor* FromPawn = PredictedSwap.FromPawn.Get())
+    {
+        FromPawn->SetActorHiddenInGame(false);
+        if (PC) PC->SetViewTarget(FromPawn);
+    }
+
+    PredictedSwap = FPartySwapPrediction();
+    LastSwapTime = -1.e6f;
+}
+
+void PartyCombatComponent::ClientConfirmSwap_Implementation(uint8 InputSeq, int8 CarriedCombo)
+{
+    if (!PredictedSwap.IsValid() || PredictedSwap.InputSeq != InputSeq) return;
+
+    // 서버와 같은 콤보 인계 → 다음 공격 입력의 예측 인덱스가 서버 판정과 일치
+    if (CarriedCombo >= 0 && PartySlots.IsValidIndex(PredictedSwap.ToIndex))
+    {
+        if (ABaseCharacter* NewPawn = PartySlots[PredictedSwap.ToIndex].SpawnedPawn.Get())
+        {
+            if (UMeeleAttackComponent* Melee = NewPawn->FindComponentByClass<UMeeleAttackComponent>())
+                Melee->CarryCombo(CarriedCombo, ComboCarryWindow);
+        }
+    }
+
+    PredictedSwap = FPartySwapPrediction();
+}
+
+void PartyCombatComponent::ClientRejectSwap_Implementation(uint8 InputSeq)
+{
+    // 가장 최근 예측이 거부된 경우에만 되돌림
+    if (PredictedSwap.IsValid() && PredictedSwap.InputSeq == InputSeq)
+        RevertPredictedSwap();
+}
+
+void PartyCombatComponent::OnRep_ActiveIndex()
+{
+    // 서버 큐잉 스왑 등 예측 없이 바뀐 경우도 여기서 쿨다운/UI 갱신
+    if (const UWorld* World = GetWorld())
+        LastSwapTime = World->GetTimeSeconds();
+    OnActiveChanged.Broadcast(ActiveIndex);
+}
+
+void PartyCombatComponent::OnRep_PartyPawns()
+{
+    for (int32 i = 0; i < PartyPawns.Num() && i < PartySlots.Num(); ++i)
+    {
+        PartySlots[i].SpawnedPawn = PartyPawns[i];
+    }
+}
+
+namespace
+{
+    void SetMoveIgnore(APawn* A, APawn* B, bool bIgnore)
+    {
+        if (!A || !B) return;
+        if (UPrimitiveComponent* RootA = Cast<UPrimitiveComponent>(A->GetRootComponent()))
+            RootA->IgnoreActorWhenMoving(B, bIgnore);
+        if (UPrimitiveComponent* RootB = Cast<UPrimitiveComponent>(B->GetRootComponent()))
+            RootB->IgnoreActorWhenMoving(A, bIgnore);
+    }
+}
+
+bool PartyCombatComponent::BeginAssist(ABaseCharacter* Pawn, ABaseCharacter* Incoming)
+{
+    UWorld* World = GetWorld();
+    UPartyAssistScheduler* Scheduler = World ? World->GetSubsystem<UPartyAssistScheduler>() : nullptr;
+    if (!Scheduler || !Scheduler->RequestAssist(this, Pawn, AssistWindow, MaxSimulatedPawns))
+        return false;
+
+    AAIController* AI = nullptr;
+    while (!AI && IdleAssistControllers.Num() > 0)
+        AI = IdleAssistControllers.Pop(false);
+    if (!AI)
+    {
+        FActorSpawnParameters Params;
+        Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        UClass* Cls = AssistControllerClass ? AssistControllerClass.Get() : AAIController::StaticClass();
+        AI = World->SpawnActor<AAIController>(Cls, FTransform::Identity, Params);
+    }
+    if (!AI)
+    {
+        Scheduler->CancelAssist(Pawn);
+        return false;
+    }
+
+    AI->Possess(Pawn);
+    if (AssistBehavior)
+        AI->RunBehaviorTree(AssistBehavior);
+
+    // 같은 위치에서 교대하므로 두 캡슐이 서로 밀어내지 않도록
+    SetMoveIgnore(Pawn, Incoming, true);
+    return true;
+}
+
+void PartyCombatComponent::ReleaseAssist(APawn* Pawn)
+{
+    if (!Pawn) return;
+
+    if (AAIController* AI = Cast<AAIController>(Pawn->GetController()))
+    {
+        AI->StopMovement();
+        AI->UnPossess();
+        IdleAssistControllers.Add(AI);
+    }
+
+    for (const FPartySlot& Slot : PartySlots)
+    {
+        if (APawn* Other = Cast<APawn>(Slot.SpawnedPawn.Get()))
+        {
+            if (Other != Pawn) SetMoveIgnore(Pawn, Other, false);
+        }
+    }
+}
+
+void PartyCombatComponent::OnAssistFinished(APawn* Pawn)
+{
+    ReleaseAssist(Pawn);
+
+    // 그 사이 플레이어가 다시 빙의했다면 휴면시키지 않음
+    if (ABaseCharacter* Character = Cast<ABaseCharacter>(Pawn))
+    {
+        if (Character != GetActivePawn())
+            DeactivatePawn(Character);
+    }
 }
 
 void PartyCombatComponent::ActivatePawn(ABaseCharacter* NewPawn, ABaseCharacter* OldPawn)
 {
     if (!NewPawn) return;
 
+    // 넷 휴면 해제가 먼저: 이후 변경(위치 스냅/표시)이 다시 복제되도록
+    if (NewPawn->HasAuthority())
+    {
+        NewPawn->SetNetDormancy(DORM_Awake);
+        NewPawn->ForceNetUpdate();
+    }
+
     NewPawn->SetActorHiddenInGame(false);
     NewPawn->SetActorEnableCollision(true);
-    NewPawn->SetActorTickEnabled(true);
+
+    FPartyDormantState State;
+    if (DormantStates.RemoveAndCopyValue(NewPawn, State))
+    {
+        // 스왑 위치로 스냅된 뒤이므로 새 위치에서 바디 생성
+        for (const TWeakObjectPtr<UPrimitiveComponent>& Prim : State.PhysicsComponents)
+        {
+            if (Prim.IsValid() && Prim->IsRegistered()) Prim->RecreatePhysicsState();
+        }
+        for (const FPartyDormantState::FMeshState& M : State.Meshes)
+        {
+            if (!M.Mesh.IsValid()) continue;
+            M.Mesh->bPauseAnims = M.bPauseAnims;
+            M.Mesh->bNoSkeletonUpdate = M.bNoSkeletonUpdate;
+            M.Mesh->ResumeClothingSimulation();
+        }
+        for (const TWeakObjectPtr<UActorComponent>& Comp : State.TickingComponents)
+        {
+            if (Comp.IsValid()) Comp->SetComponentTickEnabled(true);
+        }
+        for (const TWeakObjectPtr<AActor>& Actor : State.TickingActors)
+        {
+            if (Actor.IsValid()) Actor->SetActorTickEnabled(true);
+        }
+    }
+    else
+    {
+        NewPawn->SetActorTickEnabled(true);
+    }
 
     // 연출(카메라 컷/FX/사운드) 필요시 여기서 처리
     // UGameplayStatics::SpawnEmitterAtLocation(...);
@@ -113,9 +589,102 @@ void PartyCombatComponent::ActivatePawn(ABaseCharacter* NewPawn, ABaseCharacter*
 void PartyCombatComponent::DeactivatePawn(ABaseCharacter* Pawn)
 {
     if (!Pawn) return;
+    if (DormantStates.Contains(Pawn)) return; // 이미 휴면
+
+    // 진행 중 공격 정리: 휴면 중 페이즈 타이머가 틱/트레이서를 되살리지 않도록
+    if (UMeeleAttackComponent* Melee = Pawn->FindComponentByClass<UMeeleAttackComponent>())
+        Melee->CancelAttack();
+    if (UCharacterMovementComponent* Move = Pawn->FindComponentByClass<UCharacterMovementComponent>())
+        Move->StopMovementImmediately();
+
     Pawn->SetActorHiddenInGame(true);
     Pawn->SetActorEnableCollision(false);
-    Pawn->SetActorTickEnabled(false);
+
+    FPartyDormantState& State = DormantStates.Add(Pawn);
+
+    // 폰 + 부착 액터(무기/이펙트 액터) 전체를 재귀로
+    TArray<AActor*> Actors;
+    Actors.Add(Pawn);
+    Pawn->GetAttachedActors(Actors, false, true);
+
+    for (AActor* Actor : Actors)
+    {
+        if (Actor->IsActorTickEnabled())
+        {
+            State.TickingActors.Add(Actor);
+            Actor->SetActorTickEnabled(false);
+        }
+
+        Actor->ForEachComponent<UActorComponent>(false, [&State](UActorComponent* Comp)
+        {
+            if (Comp->IsComponentTickEnabled())
+            {
+                State.TickingComponents.Add(Comp);
+                Comp->SetComponentTickEnabled(false);
+            }
+
+            // 애니메이션 평가/본 갱신/클로스 정지
+            if (USkeletalMeshComponent* Mesh = Cast<USkeletalMeshComponent>(Comp))
+            {
+                FPartyDormantState::FMeshState& M = State.Meshes.AddDefaulted_GetRef();
+                M.Mesh = Mesh;
+                M.bPauseAnims = Mesh->bPauseAnims;
+                M.bNoSkeletonUpdate = Mesh->bNoSkeletonUpdate;
+                Mesh->bPauseAnims = true;
+                Mesh->bNoSkeletonUpdate = true;
+                Mesh->SuspendClothingSimulation();
+            }
+
+            // 충돌 OFF만으로는 바디가 물리 씬(브로드페이즈)에 남음 → 물리 상태 자체를 해제
+            if (UPrimitiveComponent* Prim = Cast<UPrimitiveComponent>(Comp))
+            {
+                if (Prim->IsPhysicsStateCreated())
+                {
+                    State.PhysicsComponents.Add(Prim);
+                    Prim->DestroyPhysicsState();
+                }
+            }
+        });
+    }
+
+    // 서버: 숨김 상태를 마지막으로 보낸 뒤 채널 휴면 → 이후 속성 비교/전송 없음
+    if (Pawn->HasAuthority())
+    {
+        Pawn->ForceNetUpdate();
+        Pawn->SetNetDormancy(DORM_DormantAll);
+    }
+}
+
+void PartyCombatComponent::DumpPawnCosts() const
+{
+    for (int32 i = 0; i < PartySlots.Num(); ++i)
+    {
+        const ABaseCharacter* Pawn = PartySlots[i].SpawnedPawn.Get();
+        if (!Pawn)
+        {
+            UE_LOG(LogTemp, Log, TEXT("Party[%d] %s: not spawned"), i, *PartySlots[i].CharacterClass.ToString());
+            continue;
+        }
+
+        TArray<AActor*> Actors;
+        Actors.Add(const_cast<ABaseCharacter*>(Pawn));
+        Pawn->GetAttachedActors(Actors, false, true);
+
+        int32 TickingActors = 0, TickingComps = 0, PhysicsBodies = 0;
+        for (const AActor* Actor : Actors)
+        {
+            TickingActors += Actor->IsActorTickEnabled() ? 1 : 0;
+            Actor->ForEachComponent<UActorComponent>(false, [&](const UActorComponent* Comp)
+            {
+                TickingComps += Comp->IsComponentTickEnabled() ? 1 : 0;
+                PhysicsBodies += Comp->IsPhysicsStateCreated() ? 1 : 0;
+            });
+        }
+
+        UE_LOG(LogTemp, Log, TEXT("Party[%d] %s%s: ticking actors %d, ticking components %d, physics bodies %d, net dormancy %d"),
+            i, *Pawn->GetName(), i == ActiveIndex ? TEXT(" (active)") : TEXT(""),
+            TickingActors, TickingComps, PhysicsBodies, (int32)Pawn->NetDormancy);
+    }
 }
 
 ABaseCharacter* PartyCombatComponent::GetActivePawn() const
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Engine/StreamableManager.h"
 #include "DRPartyComponent.generated.h"
 
 USTRUCT(BlueprintType)
@@ -11,13 +12,47 @@ struct FPartySlot
 {
 	GENERATED_BODY()
 
-	// 사용 캐릭터 클래스(블프에서 세팅)
+	// 사용 캐릭터 클래스(블프에서 세팅). 소프트 참조 → InitializeParty에서 비동기 로드
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
-	TSubclassOf<class BaseCharacter> CharacterClass;
+	TSoftClassPtr<class BaseCharacter> CharacterClass;
 
 	// 런타임에 스폰된 폰(풀링 대상)
 	UPROPERTY(Transient)
 	TWeakObjectPtr<class BaseCharacter> SpawnedPawn = nullptr;
+
+	// 비동기 로드 핸들 (로드 후에도 클래스가 언로드되지 않도록 유지)
+	TSharedPtr<FStreamableHandle> LoadHandle;
+	int32 LoadPriority = 0;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPartySlotReady, int32, SlotIndex);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPartyActiveChanged, int32, SlotIndex);
+
+// 소유 클라이언트의 스왑 예측 (한 번에 하나만)
+struct FPartySwapPrediction
+{
+    uint8 InputSeq = 0;
+    int32 ToIndex = INDEX_NONE;
+    TWeakObjectPtr<AActor> FromPawn;
+    TWeakObjectPtr<AActor> ToPawn;
+
+    bool IsValid() const { return ToIndex != INDEX_NONE; }
+};
+
+// 휴면 진입 시 꺼둔 것들. ActivatePawn에서 켜져 있던 것만 그대로 복원
+struct FPartyDormantState
+{
+    struct FMeshState
+    {
+        TWeakObjectPtr<class USkeletalMeshComponent> Mesh;
+        bool bPauseAnims = false;
+        bool bNoSkeletonUpdate = false;
+    };
+
+    TArray<TWeakObjectPtr<AActor>> TickingActors;                     // 폰 + 부착 액터(무기 등)
+    TArray<TWeakObjectPtr<UActorComponent>> TickingComponents;
+    TArray<TWeakObjectPtr<class UPrimitiveComponent>> PhysicsComponents; // 브로드페이즈에서 뺀 바디
+    TArray<FMeshState> Meshes;
 };
 
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
@@ -33,26 +68,139 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Party")
     TArray<FPartySlot> PartySlots; // Size=3 권장
 
-    // 현재 활성 슬롯 인덱스
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Party")
+    // 현재 활성 슬롯 인덱스. 서버 판정, 소유 클라이언트에만 복제 (다른 클라이언트는 휴면/표시 상태로 전환을 본다)
+    UPROPERTY(ReplicatedUsing = OnRep_ActiveIndex, VisibleAnywhere, BlueprintReadOnly, Category = "Party")
     int32 ActiveIndex = INDEX_NONE;
 
-    // 초기화(맵 로드 시, BeginPlay에서 호출)
+    // 스왑 쿨다운(초). 서버가 판정하고 클라이언트는 예측 전에 같은 값으로 사전 검사
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Party", meta = (ClampMin = "0.0"))
+    float SwapCooldown = 1.f;
+
+    // 나가는 캐릭터의 진행 중 콤보를 들어오는 캐릭터가 다음 타부터 이어받음
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Party")
+    bool bTransferCombo = true;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Party", meta = (EditCondition = "bTransferCombo", ClampMin = "0.0"))
+    float ComboCarryWindow = 0.6f;
+
+    // 스왑 어시스트: 나간 멤버가 AssistWindow 동안 AI 조종으로 콤보/시전을 마무리한 뒤 휴면
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Party|Assist")
+    bool bEnableSwapAssist = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Party|Assist", meta = (EditCondition = "bEnableSwapAssist", ClampMin = "0.0"))
+    float AssistWindow = 1.5f;
+
+    // 이 파티에서 동시에 시뮬레이션하는 폰 수 (활성 1 + 어시스트). 초과 시 가장 먼저 끝날 어시스트를 조기 종료
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Party|Assist", meta = (EditCondition = "bEnableSwapAssist", ClampMin = "1", ClampMax = "3"))
+    int32 MaxSimulatedPawns = 2;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Party|Assist", meta = (EditCondition = "bEnableSwapAssist"))
+    TSubclassOf<class AAIController> AssistControllerClass;
+
+    // 선택: 어시스트 중 실행할 비헤이비어 트리 (없으면 진행 중 콤보/버퍼 입력만 마무리)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Party|Assist", meta = (EditCondition = "bEnableSwapAssist"))
+    class UBehaviorTree* AssistBehavior = nullptr;
+
+    // UPartyAssistScheduler가 창 만료/공격 종료 시 호출 → AI 해제 후 휴면
+    void OnAssistFinished(class APawn* Pawn);
+
+    // 활성 멤버 변경 (서버: 스왑 실행 / 클라이언트: 확정 수신)
+    UPROPERTY(BlueprintAssignable, Category = "Party")
+    FOnPartyActiveChanged OnActiveChanged;
+
+    // 로드 중인 슬롯으로 들어온 스왑 요청. 로드 완료 시 실행, 그 사이 새 요청이 오면 마지막 요청으로 교체
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Party")
+    int32 PendingSwapIndex = INDEX_NONE;
+
+    // 슬롯 클래스 로드 + 풀 스폰 완료
+    UPROPERTY(BlueprintAssignable, Category = "Party")
+    FOnPartySlotReady OnPartySlotReady;
+
+    // 초기화(맵 로드 시, BeginPlay에서 호출). 시작 슬롯 → 다음 스왑 후보 → 나머지 순으로 비동기 프리로드
     UFUNCTION(BlueprintCallable, Category = "Party")
     void InitializeParty();
 
-    // 슬롯 스왑 (0,1,2)
+    // 슬롯 스왑 (0,1,2). 서버는 바로 실행, 소유 클라이언트는 카메라/표시를 예측 전환하고 서버 판정을 요청.
+    // 대상이 아직 로드 중이면 서버는 현재 폰을 유지한 채 PendingSwapIndex로 큐잉
     UFUNCTION(BlueprintCallable, Category = "Party")
     void SwapTo(int32 SlotIndex);
 
+    UFUNCTION(BlueprintPure, Category = "Party")
+    bool IsSwapOnCooldown() const;
+
+    // 즉시 스왑 가능한 슬롯인지 (폰 스폰 완료)
+    UFUNCTION(BlueprintPure, Category = "Party")
+    bool IsSlotReady(int32 SlotIndex) const;
+
     // 현재 활성 폰 가져오기
     UFUNCTION(BlueprintPure, Category = "Party")
     class BaseCharacter* GetActivePawn() const;
 
+protected:
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+    // 스폰된 파티 폰 (소유 클라이언트 예측용). 서버 스폰 시에만 갱신
+    UPROPERTY(ReplicatedUsing = OnRep_PartyPawns)
+    TArray<class BaseCharacter*> PartyPawns;
+
+    UFUNCTION()
+    void OnRep_ActiveIndex();
+
+    UFUNCTION()
+    void OnRep_PartyPawns();
+
+    UFUNCTION(Server, Reliable)
+    void ServerSwapTo(uint8 SlotIndex, uint8 InputSeq);
+
+    // CarriedCombo: 들어온 캐릭터가 이어받은 콤보 인덱스 (-1 = 없음)
+    UFUNCTION(Client, Reliable)
+    void ClientConfirmSwap(uint8 InputSeq, int8 CarriedCombo);
+
+    UFUNCTION(Client, Reliable)
+    void ClientRejectSwap(uint8 InputSeq);
+
 private:
     class APlayerController* GetPC() const;
+    // 클래스가 로드돼 있을 때만 스폰 (동기 로드 없음)
     class BaseCharacter* SpawnIfNeeded(int32 SlotIndex);
+
+    // 이미 더 높은 우선순위로 로드 중이면 무시
+    void RequestSlotLoad(int32 SlotIndex, int32 Priority);
+    void OnSlotLoaded(int32 SlotIndex);
+    // 활성 슬롯 다음 후보를 우선 로드
+    void PrioritizeNextSwap();
+
+    // 서버 권한 스왑 (위치/속도/콤보 인계 + Possess). 로드 중이라 큐잉되면 false
+    bool ExecuteSwap(int32 SlotIndex, int32* OutCarriedCombo = nullptr);
+
+    // 소유 클라이언트: 카메라/표시만 먼저 전환, 거부 시 되돌림
+    void PredictSwap(int32 SlotIndex, uint8 InputSeq);
+    void RevertPredictedSwap();
+
+    // 어시스트 시작: AI 빙의 + 들어온 폰과 이동 충돌 무시. 스케줄러가 거부하면 false
+    bool BeginAssist(BaseCharacter* Pawn, BaseCharacter* Incoming);
+    // AI 해제 + 충돌 무시 복원 (휴면 처리는 호출 측)
+    void ReleaseAssist(class APawn* Pawn);
+
+    // 재사용 대기 중인 어시스트용 AI 컨트롤러
+    UPROPERTY(Transient)
+    TArray<class AAIController*> IdleAssistControllers;
+
+    uint8 LocalSwapSeq = 0;
+    FPartySwapPrediction PredictedSwap;
+    float LastSwapTime = -1.e6f;
+
+    // 휴면 해제: DeactivatePawn에서 꺼둔 틱/애니메이션/물리/넷 상태를 그대로 복원
     void ActivatePawn(BaseCharacter* NewPawn, BaseCharacter* OldPawn);
+    // 휴면: 숨김/충돌 OFF + 컴포넌트 틱(부착 액터 포함) 정지, 애니메이션 정지, 물리 바디 해제, 넷 휴면
     void DeactivatePawn(BaseCharacter* Pawn);
+
+    // 휴면 폰 상태 (키: 폰)
+    TMap<TWeakObjectPtr<AActor>, FPartyDormantState> DormantStates;
+
+public:
+    // 디버그: 파티 폰별 틱/물리/넷 휴면 상태 출력 (Party.Dump)
+    void DumpPawnCosts() const;
 		
 };
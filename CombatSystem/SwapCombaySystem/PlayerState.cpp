@@ -4,31 +4,224 @@
 
 #include "PlayerState.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
+#include "CombatNet.h"
 
 APlayerState::APlayerState()
 {
     bReplicates = true;
-    NetUpdateFrequency = 30.f;
+    // 스탯은 이벤트성 변경뿐이고 변경 시 ForceNetUpdate로 즉시 보낸다 → 고정 30Hz 대신 낮은 기본 빈도
+    NetUpdateFrequency = 10.f;
+    MinNetUpdateFrequency = 2.f;
 }
 
-// void APlayerState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Out) const
-// {
-//     Super::GetLifetimeReplicatedProps(Out);
-//     // DOREPLIFETIME(APlayerState, BaseStats);
-//     // DOREPLIFETIME(APlayerState, Damage);
-//     // DOREPLIFETIME(APlayerState, Defense);
-//     // DOREPLIFETIME(APlayerState, Computed);
-//     // DOREPLIFETIME(APlayerState, SelectedItemIndex);
-//     // DOREPLIFETIME(APlayerState, SelectedEquipmentIndex);
-// }
+void APlayerState::PostInitializeComponents()
+{
+    Super::PostInitializeComponents();
+    RecalculateTotals();
+}
+
+void APlayerState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Out) const
+{
+    Super::GetLifetimeReplicatedProps(Out);
+
+    // 푸시 모델: MARK_PROPERTY_DIRTY 된 경우에만 비교/전송
+    FDoRepLifetimeParams OwnerOnly;
+    OwnerOnly.bIsPushBased = true;
+    OwnerOnly.Condition = COND_OwnerOnly;
+    DOREPLIFETIME_WITH_PARAMS_FAST(APlayerState, ReplicatedBaseStats, OwnerOnly);
+    DOREPLIFETIME_WITH_PARAMS_FAST(APlayerState, SelectedItemIndex, OwnerOnly);
+
+    // 다른 플레이어에게는 합계와 외형용 장비 슬롯만
+    FDoRepLifetimeParams Everyone;
+    Everyone.bIsPushBased = true;
+    DOREPLIFETIME_WITH_PARAMS_FAST(APlayerState, Computed, Everyone);
+    DOREPLIFETIME_WITH_PARAMS_FAST(APlayerState, SelectedEquipmentIndex, Everyone);
+}
+
+bool FDRComputedTotals::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    int32 Attack = CombatNet::QuantizeStat(FinalAttack);
+    int32 Def = CombatNet::QuantizeStat(FinalDefense);
+    CombatNet::SerializeQuantizedStat(Ar, Attack);
+    CombatNet::SerializeQuantizedStat(Ar, Def);
+    if (Ar.IsLoading())
+    {
+        FinalAttack = CombatNet::DequantizeStat(Attack);
+        FinalDefense = CombatNet::DequantizeStat(Def);
+    }
+    bOutSuccess = !Ar.IsError();
+    return true;
+}
+
+void APlayerState::MarkStatsDirty(bool bBaseChanged, bool bComputedChanged)
+{
+    if (bBaseChanged)
+    {
+        MARK_PROPERTY_DIRTY_FROM_NAME(APlayerState, ReplicatedBaseStats, this);
+    }
+    if (bComputedChanged)
+    {
+        MARK_PROPERTY_DIRTY_FROM_NAME(APlayerState, Computed, this);
+    }
+    if (bBaseChanged || bComputedChanged)
+    {
+        ForceNetUpdate();
+    }
+}
+
+void APlayerState::SetSelectedItemIndex(int32 Index)
+{
+    if (SelectedItemIndex != Index)
+    {
+        SelectedItemIndex = Index;
+        MARK_PROPERTY_DIRTY_FROM_NAME(APlayerState, SelectedItemIndex, this);
+    }
+}
+
+void APlayerState::SetSelectedEquipmentIndex(int32 Index)
+{
+    if (SelectedEquipmentIndex != Index)
+    {
+        SelectedEquipmentIndex = Index;
+        MARK_PROPERTY_DIRTY_FROM_NAME(APlayerState, SelectedEquipmentIndex, this);
+    }
+}
 
 void APlayerState::RecalculateTotals()
 {
-    Computed.FinalAttack = Damage.Physical + BaseStats.PhysicalStrength * 2.f;
-    Computed.FinalDefense = Defense.Physical + BaseStats.Dexterity * 1.5f;
+    const uint32 PrevVersion = Stats.GetVersion();
+    DRApplyBaseStats(Stats, BaseStats, Damage, Defense, Resistance, DamageMultiplier);
+    if (HasAuthority() && Stats.GetVersion() != PrevVersion)
+    {
+        ReplicatedBaseStats.Capture(Stats);
+        MarkStatsDirty(true, false);
+    }
+    RefreshDerived();
+}
+
+void APlayerState::RefreshDerived()
+{
+    if (DerivedVersion == Stats.GetVersion())
+    {
+        return;
+    }
+    DerivedVersion = Stats.GetVersion();
+
+    Stats.BuildLanes(AttackLanes, MitigationLanes);
+
+    float TotalAttack = 0.f;
+    for (float Channel : AttackLanes.V)
+    {
+        TotalAttack += Channel;
+    }
+    // 클라이언트의 Computed는 서버(수정자 포함) 값을 복제로 받는다
+    if (HasAuthority())
+    {
+        const FDRComputedTotals Prev = Computed;
+        Computed.FinalAttack = TotalAttack;
+        Computed.FinalDefense = Stats.Get(EDRStat::DefensePhysical) + Stats.Get(EDRStat::Dexterity) * 1.5f;
+        if (Prev.FinalAttack != Computed.FinalAttack || Prev.FinalDefense != Computed.FinalDefense)
+        {
+            MarkStatsDirty(false, true);
+            OnStatsChanged.Broadcast();
+        }
+    }
+}
+
+FDRStatModifierHandle APlayerState::AddStatModifier(const FDRStatModifier& Modifier, UObject* Source)
+{
+    const FDRStatModifierHandle Handle = Stats.AddModifier(Modifier, Source);
+    RefreshDerived();
+    return Handle;
 }
 
-//void APlayerState::OnRep_BaseStats() {}
-//void APlayerState::OnRep_Damage() {}
-//void APlayerState::OnRep_Defense() {}
-//void APlayerState::OnRep_Computed() {}
+bool APlayerState::RemoveStatModifier(FDRStatModifierHandle& Handle)
+{
+    const bool bRemoved = Stats.RemoveModifier(Handle);
+    RefreshDerived();
+    return bRemoved;
+}
+
+int32 APlayerState::RemoveStatModifiersFromSource(UObject* Source)
+{
+    const int32 Removed = Stats.RemoveModifiersFromSource(Source);
+    RefreshDerived();
+    return Removed;
+}
+
+float APlayerState::ResolveDamageAgainst(const APlayerState* Target, FDRElementalDamage& OutBreakdown) const
+{
+    OutBreakdown = FDRElementalDamage();
+    if (!Target)
+    {
+        return 0.f;
+    }
+
+    FDRElementLanes PerChannel;
+    const float Total = DRElemental::ResolveHit(AttackLanes, Target->MitigationLanes, &PerChannel);
+    PerChannel.To(OutBreakdown);
+    return Total;
+}
+
+TArray<float> APlayerState::ResolveDamageAgainstMany(const TArray<APlayerState*>& Targets) const
+{
+    TArray<float> Result;
+    Result.SetNumZeroed(Targets.Num());
+
+    // 유효 대상의 방어 레인만 연속 버퍼로 모아 한 번에 처리
+    BatchMitigations.Reset();
+    BatchIndices.Reset();
+    for (int32 i = 0; i < Targets.Num(); ++i)
+    {
+        if (const APlayerState* Target = Targets[i])
+        {
+            BatchMitigations.Add(Target->MitigationLanes);
+            BatchIndices.Add(i);
+        }
+    }
+
+    TArray<float, TInlineAllocator<32>> Totals;
+    Totals.SetNumUninitialized(BatchMitigations.Num());
+    DRElemental::ResolveHits(AttackLanes, BatchMitigations, Totals);
+
+    for (int32 k = 0; k < BatchIndices.Num(); ++k)
+    {
+        Result[BatchIndices[k]] = Totals[k];
+    }
+    return Result;
+}
+
+float APlayerState::ResolveIncomingDamage(const FDRElementalDamage& Incoming) const
+{
+    return DRElemental::ResolveHit(FDRElementLanes::From(Incoming), MitigationLanes);
+}
+
+void APlayerState::OnRep_BaseStats()
+{
+    // EDRStat 순서: 기본 5개 → Damage/Defense/Resistance/Multiplier 각 8채널
+    const float* V = ReplicatedBaseStats.Values;
+    BaseStats.Health = V[(int32)EDRStat::Health];
+    BaseStats.PhysicalStrength = V[(int32)EDRStat::PhysicalStrength];
+    BaseStats.Dexterity = V[(int32)EDRStat::Dexterity];
+    BaseStats.Intelligence = V[(int32)EDRStat::Intelligence];
+    BaseStats.Spiritual = V[(int32)EDRStat::Spiritual];
+
+    FDRElementLanes Lanes;
+    FMemory::Memcpy(Lanes.V, V + (int32)EDRStat::DamagePhysical, sizeof(Lanes.V));
+    Lanes.To(Damage);
+    FMemory::Memcpy(Lanes.V, V + (int32)EDRStat::DefensePhysical, sizeof(Lanes.V));
+    Lanes.To(Defense);
+    FMemory::Memcpy(Lanes.V, V + (int32)EDRStat::ResistPhysical, sizeof(Lanes.V));
+    Lanes.To(Resistance);
+    FMemory::Memcpy(Lanes.V, V + (int32)EDRStat::MultiplierPhysical, sizeof(Lanes.V));
+    Lanes.To(DamageMultiplier);
+
+    RecalculateTotals();
+    OnStatsChanged.Broadcast();
+}
+
+void APlayerState::OnRep_Computed()
+{
+    OnStatsChanged.Broadcast();
+}
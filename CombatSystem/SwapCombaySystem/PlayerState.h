@@ -5,6 +5,9 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/PlayerState.h"
+#include "ElementalDamage.h"
+#include "StatModifiers.h"
+#include "StatReplication.h"
 #include "DRPlayerState.generated.h"
 
 // === 여기서 USTRUCT들을 먼저 선언 ===
@@ -44,13 +47,67 @@ struct FDRElementalDefense {
     UPROPERTY(EditAnywhere, BlueprintReadWrite) float Holy = 0.f;
 };
 
+// 속성 저항 (0.25 = 25% 감소, 음수 = 약점). [-1, 0.9]로 클램프
+USTRUCT(BlueprintType)
+struct FDRElementalResistance {
+    GENERATED_BODY()
+    UPROPERTY(EditAnywhere, BlueprintReadWrite) float Physical = 0.f;
+    UPROPERTY(EditAnywhere, BlueprintReadWrite) float Magical = 0.f;
+    UPROPERTY(EditAnywhere, BlueprintReadWrite) float Fire = 0.f;
+    UPROPERTY(EditAnywhere, BlueprintReadWrite) float Ice = 0.f;
+    UPROPERTY(EditAnywhere, BlueprintReadWrite) float Wind = 0.f;
+    UPROPERTY(EditAnywhere, BlueprintReadWrite) float Ground = 0.f;
+    UPROPERTY(EditAnywhere, BlueprintReadWrite) float Dark = 0.f;
+    UPROPERTY(EditAnywhere, BlueprintReadWrite) float Holy = 0.f;
+};
+
+// 공격 측 속성 배율 (장비/버프)
+USTRUCT(BlueprintType)
+struct FDRElementalMultiplier {
+    GENERATED_BODY()
+    UPROPERTY(EditAnywhere, BlueprintReadWrite) float Physical = 1.f;
+    UPROPERTY(EditAnywhere, BlueprintReadWrite) float Magical = 1.f;
+    UPROPERTY(EditAnywhere, BlueprintReadWrite) float Fire = 1.f;
+    UPROPERTY(EditAnywhere, BlueprintReadWrite) float Ice = 1.f;
+    UPROPERTY(EditAnywhere, BlueprintReadWrite) float Wind = 1.f;
+    UPROPERTY(EditAnywhere, BlueprintReadWrite) float Ground = 1.f;
+    UPROPERTY(EditAnywhere, BlueprintReadWrite) float Dark = 1.f;
+    UPROPERTY(EditAnywhere, BlueprintReadWrite) float Holy = 1.f;
+};
+
+// 모든 클라이언트에 복제: 0.01 단위 양자화 + 가변 길이 정수 (float 2개 8바이트 → 보통 4~6바이트)
 USTRUCT(BlueprintType)
 struct FDRComputedTotals {
     GENERATED_BODY()
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly) float FinalAttack = 0.f;
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly) float FinalDefense = 0.f;
+
+    bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FDRComputedTotals> : public TStructOpsTypeTraitsBase2<FDRComputedTotals>
+{
+    enum { WithNetSerializer = true };
 };
 
+// 스탯 구조체 값을 수정자 집계기의 기본값으로 반영 (APlayerState / UCombatStatsComponent 공용)
+inline void DRApplyBaseStats(FDRStatAggregator& Stats, const FDRBaseStats& Base, const FDRElementalDamage& Damage,
+    const FDRElementalDefense& Defense, const FDRElementalResistance& Resistance, const FDRElementalMultiplier& Multiplier)
+{
+    Stats.SetBase(EDRStat::Health, Base.Health);
+    Stats.SetBase(EDRStat::PhysicalStrength, Base.PhysicalStrength);
+    Stats.SetBase(EDRStat::Dexterity, Base.Dexterity);
+    Stats.SetBase(EDRStat::Intelligence, Base.Intelligence);
+    Stats.SetBase(EDRStat::Spiritual, Base.Spiritual);
+    Stats.SetBaseChannels(EDRStat::DamagePhysical, FDRElementLanes::From(Damage));
+    Stats.SetBaseChannels(EDRStat::DefensePhysical, FDRElementLanes::From(Defense));
+    Stats.SetBaseChannels(EDRStat::ResistPhysical, FDRElementLanes::From(Resistance));
+    Stats.SetBaseChannels(EDRStat::MultiplierPhysical, FDRElementLanes::From(Multiplier));
+}
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnDRStatsChanged);
+
 // === UCLASS는 USTRUCT들 뒤에 ===
 UCLASS()
 class DUSKREGION_API APlayerState : public APlayerState
@@ -70,22 +127,91 @@ public:
     FDRElementalDefense Defense;
 
     UPROPERTY(BlueprintReadOnly, Category = "Stats")
+    FDRElementalResistance Resistance;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Stats")
+    FDRElementalMultiplier DamageMultiplier;
+
+    UPROPERTY(ReplicatedUsing = OnRep_Computed, BlueprintReadOnly, Category = "Stats")
     FDRComputedTotals Computed;
 
-    UPROPERTY(BlueprintReadOnly, Category = "Inventory")
+    UPROPERTY(Replicated, BlueprintReadOnly, Category = "Inventory")
     int32 SelectedItemIndex = -1;
 
-    UPROPERTY(BlueprintReadOnly, Category = "Equipment")
+    UPROPERTY(Replicated, BlueprintReadOnly, Category = "Equipment")
     int32 SelectedEquipmentIndex = -1;
 
+    // 서버: 최종값 변경 / 클라이언트: 복제 수신 시
+    UPROPERTY(BlueprintAssignable, Category = "Stats")
+    FOnDRStatsChanged OnStatsChanged;
+
+    UFUNCTION(BlueprintCallable, Category = "Inventory")
+    void SetSelectedItemIndex(int32 Index);
+
+    UFUNCTION(BlueprintCallable, Category = "Equipment")
+    void SetSelectedEquipmentIndex(int32 Index);
+
+    virtual void PostInitializeComponents() override;
+
+    // 기본 스탯 구조체를 수정한 뒤 호출. 바뀐 스탯만 다시 계산된다
     UFUNCTION(BlueprintCallable, Category = "Stats")
     void RecalculateTotals();
 
+    // 버프/장비/파티 효과. Source를 주면 RemoveStatModifiersFromSource로 일괄 제거 가능
+    UFUNCTION(BlueprintCallable, Category = "Stats")
+    FDRStatModifierHandle AddStatModifier(const FDRStatModifier& Modifier, UObject* Source = nullptr);
+
+    UFUNCTION(BlueprintCallable, Category = "Stats")
+    bool RemoveStatModifier(UPARAM(ref) FDRStatModifierHandle& Handle);
+
+    UFUNCTION(BlueprintCallable, Category = "Stats")
+    int32 RemoveStatModifiersFromSource(UObject* Source);
+
+    // 수정자 적용 후 최종값
+    UFUNCTION(BlueprintPure, Category = "Stats")
+    float GetStat(EDRStat Stat) const { return Stats.Get(Stat); }
+
+    const FDRStatAggregator& GetStatAggregator() const { return Stats; }
+
+    // 이 플레이어가 Target을 때렸을 때의 최종 피해 (8채널 합)
+    UFUNCTION(BlueprintCallable, Category = "Stats")
+    float ResolveDamageAgainst(const APlayerState* Target, FDRElementalDamage& OutBreakdown) const;
+
+    // 광역 히트: 한 번의 공격을 여러 대상에 일괄 적용. 반환 배열은 Targets와 같은 순서 (null 대상은 0)
+    UFUNCTION(BlueprintCallable, Category = "Stats")
+    TArray<float> ResolveDamageAgainstMany(const TArray<APlayerState*>& Targets) const;
+
+    // 외부 입력 피해(환경/NPC 공격 등)를 이 플레이어의 방어로 감쇄
+    float ResolveIncomingDamage(const FDRElementalDamage& Incoming) const;
+
+    // RecalculateTotals에서 갱신되는 커널용 레인
+    const FDRElementLanes& GetAttackLanes() const { return AttackLanes; }
+    const FDRElementLanes& GetMitigationLanes() const { return MitigationLanes; }
+
 protected:
-    //UFUNCTION() void OnRep_BaseStats();
-    //UFUNCTION() void OnRep_Damage();
-    //UFUNCTION() void OnRep_Defense();
-    //UFUNCTION() void OnRep_Computed();
+    FDRStatAggregator Stats;
+
+    // 집계기 버전이 바뀐 경우에만 레인/Computed 재구성
+    uint32 DerivedVersion = MAX_uint32;
+    void RefreshDerived();
+
+    // 공격 = 채널 피해 × 배율, 방어 = (1 - 저항) × K / (K + 방어). 히트당 곱셈 8회 + 합산만 남는다
+    FDRElementLanes AttackLanes;
+    FDRElementLanes MitigationLanes;
+
+    // 광역 처리용 스크래치 (게임 스레드 전용, 용량 유지)
+    mutable TArray<FDRElementLanes> BatchMitigations;
+    mutable TArray<int32> BatchIndices;
+
+    // BaseStats/Damage/Defense/Resistance/DamageMultiplier 원본 값 → 소유 클라이언트만 (바뀐 채널만 전송)
+    UPROPERTY(ReplicatedUsing = OnRep_BaseStats)
+    FDRReplicatedBaseStats ReplicatedBaseStats;
+
+    // 서버: 스탯 변경 시 푸시 모델 더티 + 즉시 갱신 요청
+    void MarkStatsDirty(bool bBaseChanged, bool bComputedChanged);
+
+    UFUNCTION() void OnRep_BaseStats();
+    UFUNCTION() void OnRep_Computed();
 
-    // virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Out) const override;
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Out) const override;
 };
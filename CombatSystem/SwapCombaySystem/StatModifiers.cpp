@@ -0,0 +1,163 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "StatModifiers.h"
+
+FDRStatModifierHandle FDRStatAggregator::AddModifier(const FDRStatModifier& Modifier, const UObject* Source)
+{
+    const int32 StatIndex = (int32)Modifier.Stat;
+    if (StatIndex < 0 || StatIndex >= NumStats)
+    {
+        return FDRStatModifierHandle();
+    }
+
+    FEntry& Entry = Slots[StatIndex].Mods.AddDefaulted_GetRef();
+    Entry.Id = (NextSerial++ << 8) | (uint32)StatIndex;
+    if ((NextSerial & 0x00FFFFFF) == 0)
+    {
+        NextSerial = 1;
+    }
+    Entry.Op = Modifier.Op;
+    Entry.Value = Modifier.Value;
+    Entry.Priority = Modifier.Priority;
+    Entry.Source = FObjectKey(Source);
+
+    ++NumModifiers;
+    MarkDirty(StatIndex);
+
+    FDRStatModifierHandle Handle;
+    Handle.Id = Entry.Id;
+    return Handle;
+}
+
+bool FDRStatAggregator::RemoveModifier(FDRStatModifierHandle& Handle)
+{
+    if (!Handle.IsValid())
+    {
+        return false;
+    }
+
+    const int32 StatIndex = (int32)Handle.GetStat();
+    const uint32 Id = Handle.Id;
+    Handle = FDRStatModifierHandle();
+    if (StatIndex >= NumStats)
+    {
+        return false;
+    }
+
+    // 추가 순서가 Override 동률 판정에 쓰이므로 순서 유지 제거
+    const int32 Removed = Slots[StatIndex].Mods.RemoveAll([Id](const FEntry& E) { return E.Id == Id; });
+    if (Removed == 0)
+    {
+        return false;
+    }
+
+    NumModifiers -= Removed;
+    MarkDirty(StatIndex);
+    return true;
+}
+
+int32 FDRStatAggregator::RemoveModifiersFromSource(const UObject* Source)
+{
+    const FObjectKey Key(Source);
+    int32 Total = 0;
+    for (int32 i = 0; i < NumStats; ++i)
+    {
+        const int32 Removed = Slots[i].Mods.RemoveAll([&Key](const FEntry& E) { return E.Source == Key; });
+        if (Removed > 0)
+        {
+            Total += Removed;
+            MarkDirty(i);
+        }
+    }
+    NumModifiers -= Total;
+    return Total;
+}
+
+void FDRStatAggregator::SetBase(EDRStat Stat, float Value)
+{
+    FStatSlot& Slot = Slots[(int32)Stat];
+    if (Slot.Base != Value)
+    {
+        Slot.Base = Value;
+        MarkDirty((int32)Stat);
+    }
+}
+
+void FDRStatAggregator::SetBaseChannels(EDRStat FirstChannel, const FDRElementLanes& Values)
+{
+    check((int32)FirstChannel + FDRElementLanes::NumChannels <= NumStats);
+    for (int32 c = 0; c < FDRElementLanes::NumChannels; ++c)
+    {
+        SetBase((EDRStat)((int32)FirstChannel + c), Values.V[c]);
+    }
+}
+
+float FDRStatAggregator::Get(EDRStat Stat) const
+{
+    const int32 StatIndex = (int32)Stat;
+    if (DirtyMask & (1ull << StatIndex))
+    {
+        Evaluate(StatIndex);
+        DirtyMask &= ~(1ull << StatIndex);
+    }
+    return Slots[StatIndex].Final;
+}
+
+FDRElementLanes FDRStatAggregator::GetChannels(EDRStat FirstChannel) const
+{
+    FDRElementLanes Out;
+    for (int32 c = 0; c < FDRElementLanes::NumChannels; ++c)
+    {
+        Out.V[c] = Get((EDRStat)((int32)FirstChannel + c));
+    }
+    return Out;
+}
+
+void FDRStatAggregator::Flush() const
+{
+    uint64 Mask = DirtyMask;
+    while (Mask)
+    {
+        const int32 StatIndex = (int32)FMath::CountTrailingZeros64(Mask);
+        Evaluate(StatIndex);
+        Mask &= Mask - 1;
+    }
+    DirtyMask = 0;
+}
+
+void FDRStatAggregator::Evaluate(int32 StatIndex) const
+{
+    const FStatSlot& Slot = Slots[StatIndex];
+
+    float Add = 0.f;
+    float Mul = 1.f;
+    const FEntry* Override = nullptr;
+    for (const FEntry& E : Slot.Mods)
+    {
+        switch (E.Op)
+        {
+        case EDRStatModOp::Additive:       Add += E.Value; break;
+        case EDRStatModOp::Multiplicative: Mul *= E.Value; break;
+        case EDRStatModOp::Override:
+            if (!Override || E.Priority >= Override->Priority)
+            {
+                Override = &E;
+            }
+            break;
+        }
+    }
+
+    Slot.Final = Override ? Override->Value : (Slot.Base + Add) * Mul;
+}
+
+void FDRStatAggregator::BuildLanes(FDRElementLanes& OutAttack, FDRElementLanes& OutMitigation) const
+{
+    FDRElementLanes DamageLanes = GetChannels(EDRStat::DamagePhysical);
+    DamageLanes.V[0] += Get(EDRStat::PhysicalStrength) * 2.f;
+    FDRElementLanes DefenseLanes = GetChannels(EDRStat::DefensePhysical);
+    DefenseLanes.V[0] += Get(EDRStat::Dexterity) * 1.5f;
+
+    OutAttack = DRElemental::BuildAttack(DamageLanes, GetChannels(EDRStat::MultiplierPhysical));
+    OutMitigation = DRElemental::BuildMitigation(DefenseLanes, GetChannels(EDRStat::ResistPhysical));
+}
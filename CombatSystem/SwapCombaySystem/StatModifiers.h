@@ -0,0 +1,127 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "ElementalDamage.h"
+#include "StatModifiers.generated.h"
+
+// 수정자 대상 스탯. 속성 채널 블록(Damage/Defense/Resistance/Multiplier)은 각각 8개 연속 (FDRElementLanes 순서)
+UENUM(BlueprintType)
+enum class EDRStat : uint8
+{
+    Health,
+    PhysicalStrength,
+    Dexterity,
+    Intelligence,
+    Spiritual,
+
+    DamagePhysical, DamageMagical, DamageFire, DamageIce, DamageWind, DamageGround, DamageDark, DamageHoly,
+    DefensePhysical, DefenseMagical, DefenseFire, DefenseIce, DefenseWind, DefenseGround, DefenseDark, DefenseHoly,
+    ResistPhysical, ResistMagical, ResistFire, ResistIce, ResistWind, ResistGround, ResistDark, ResistHoly,
+    MultiplierPhysical, MultiplierMagical, MultiplierFire, MultiplierIce, MultiplierWind, MultiplierGround, MultiplierDark, MultiplierHoly,
+
+    Count UMETA(Hidden)
+};
+
+UENUM(BlueprintType)
+enum class EDRStatModOp : uint8
+{
+    Additive,        // 기본값에 더함
+    Multiplicative,  // 합산 결과에 곱함 (1.1 = +10%), 여러 개면 곱
+    Override,        // 결과를 대체. 여러 개면 Priority 높은 것 (같으면 나중에 추가된 것)
+};
+
+USTRUCT(BlueprintType)
+struct FDRStatModifier
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    EDRStat Stat = EDRStat::Health;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    EDRStatModOp Op = EDRStatModOp::Additive;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    float Value = 0.f;
+
+    // Override 전용
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    int32 Priority = 0;
+};
+
+// 하위 8비트 = 스탯, 상위 = 일련번호. 제거 시 해당 스탯 스택만 찾는다
+USTRUCT(BlueprintType)
+struct FDRStatModifierHandle
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    uint32 Id = 0;
+
+    bool IsValid() const { return Id != 0; }
+    EDRStat GetStat() const { return (EDRStat)(Id & 0xFF); }
+};
+
+/**
+ * 스탯별 수정자 스택 + 캐시된 최종값.
+ * 수정자 추가/제거나 기본값 변경 시 해당 스탯만 더티 표시하고, 조회(Get/Flush) 시 더티 스탯만 다시 계산한다.
+ * 프레임 단위 작업 없음. APlayerState와 NPC(UCombatStatsComponent)가 같이 쓴다.
+ */
+struct DUSKREGION_API FDRStatAggregator
+{
+    static constexpr int32 NumStats = (int32)EDRStat::Count;
+    static_assert(NumStats <= 64, "Dirty mask is 64 bits");
+
+    FDRStatModifierHandle AddModifier(const FDRStatModifier& Modifier, const UObject* Source = nullptr);
+    bool RemoveModifier(FDRStatModifierHandle& Handle);
+    // 장비 해제/버프 만료 등 출처 단위 일괄 제거. 제거된 개수 반환
+    int32 RemoveModifiersFromSource(const UObject* Source);
+
+    // 값이 바뀐 경우에만 더티
+    void SetBase(EDRStat Stat, float Value);
+    void SetBaseChannels(EDRStat FirstChannel, const FDRElementLanes& Values);
+    float GetBase(EDRStat Stat) const { return Slots[(int32)Stat].Base; }
+
+    float Get(EDRStat Stat) const;
+    FDRElementLanes GetChannels(EDRStat FirstChannel) const;
+
+    // 더티 스탯 전부 계산
+    void Flush() const;
+
+    // 기본값/수정자가 바뀔 때마다 증가 → 소유자가 파생 캐시(레인/합계) 무효화 판단에 사용
+    uint32 GetVersion() const { return Version; }
+    int32 GetNumModifiers() const { return NumModifiers; }
+
+    // 최종 스탯으로 피해 커널 레인 구성 (힘 ×2 → 물리 공격, 민첩 ×1.5 → 물리 방어)
+    void BuildLanes(FDRElementLanes& OutAttack, FDRElementLanes& OutMitigation) const;
+
+private:
+    struct FEntry
+    {
+        uint32 Id = 0;
+        EDRStatModOp Op = EDRStatModOp::Additive;
+        float Value = 0.f;
+        int32 Priority = 0;
+        FObjectKey Source;
+    };
+
+    struct FStatSlot
+    {
+        float Base = 0.f;
+        mutable float Final = 0.f;
+        // 대부분 스탯은 수정자 0~2개
+        TArray<FEntry, TInlineAllocator<2>> Mods;
+    };
+
+    FStatSlot Slots[NumStats];
+    mutable uint64 DirtyMask = 0;
+    uint32 NextSerial = 1;
+    uint32 Version = 0;
+    int32 NumModifiers = 0;
+
+    void MarkDirty(int32 StatIndex) { DirtyMask |= (1ull << StatIndex); ++Version; }
+    void Evaluate(int32 StatIndex) const;
+};
@@ -0,0 +1,75 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "StatReplication.h"
+#include "CombatNet.h"
+
+namespace
+{
+    // 연결별 기준 상태: 마지막으로 보낸 양자화 값
+    class FDRBaseStatsDeltaState : public INetDeltaBaseState
+    {
+    public:
+        int32 Quantized[FDRReplicatedBaseStats::NumStats] = {};
+
+        virtual bool IsStateEqual(INetDeltaBaseState* OtherState) override
+        {
+            const FDRBaseStatsDeltaState* Other = static_cast<const FDRBaseStatsDeltaState*>(OtherState);
+            return FMemory::Memcmp(Quantized, Other->Quantized, sizeof(Quantized)) == 0;
+        }
+    };
+}
+
+bool FDRReplicatedBaseStats::NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+{
+    if (DeltaParms.Writer)
+    {
+        const FDRBaseStatsDeltaState* OldState = static_cast<const FDRBaseStatsDeltaState*>(DeltaParms.OldState);
+
+        TSharedPtr<FDRBaseStatsDeltaState> NewState = MakeShared<FDRBaseStatsDeltaState>();
+        uint64 Mask = 0;
+        for (int32 i = 0; i < NumStats; ++i)
+        {
+            NewState->Quantized[i] = CombatNet::QuantizeStat(Values[i]);
+            // 기준 상태가 없으면(최초/리셋) 전부 전송
+            if (!OldState || OldState->Quantized[i] != NewState->Quantized[i])
+            {
+                Mask |= (1ull << i);
+            }
+        }
+
+        if (Mask == 0)
+        {
+            return false;
+        }
+
+        *DeltaParms.NewState = NewState;
+
+        FBitWriter& Writer = *DeltaParms.Writer;
+        Writer.SerializeBits(&Mask, NumStats);
+        for (uint64 Bits = Mask; Bits; Bits &= Bits - 1)
+        {
+            const int32 i = (int32)FMath::CountTrailingZeros64(Bits);
+            CombatNet::SerializeQuantizedStat(Writer, NewState->Quantized[i]);
+        }
+        return true;
+    }
+
+    if (DeltaParms.Reader)
+    {
+        FBitReader& Reader = *DeltaParms.Reader;
+        uint64 Mask = 0;
+        Reader.SerializeBits(&Mask, NumStats);
+        for (uint64 Bits = Mask; Bits && !Reader.IsError(); Bits &= Bits - 1)
+        {
+            const int32 i = (int32)FMath::CountTrailingZeros64(Bits);
+            int32 Quantized = 0;
+            CombatNet::SerializeQuantizedStat(Reader, Quantized);
+            Values[i] = CombatNet::DequantizeStat(Quantized);
+        }
+        ReceivedMask = Mask;
+        return !Reader.IsError();
+    }
+
+    return true;
+}
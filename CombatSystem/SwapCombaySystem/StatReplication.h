@@ -0,0 +1,42 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/NetSerialization.h"
+#include "StatModifiers.h"
+#include "StatReplication.generated.h"
+
+/**
+ * 소유 클라이언트용 기본 스탯 블록 (EDRStat 순서 37개 값).
+ * NetDeltaSerialize: 연결별 마지막 전송 상태 대비 바뀐 채널만 비트마스크 + 0.01 단위 양자화 값으로 보낸다.
+ * 값은 차분이 아니라 절댓값이라 수신 측이 기준 상태와 어긋나도 누적 오차가 생기지 않는다.
+ */
+USTRUCT()
+struct FDRReplicatedBaseStats
+{
+    GENERATED_BODY()
+
+    static constexpr int32 NumStats = FDRStatAggregator::NumStats;
+
+    float Values[NumStats] = {};
+
+    // 수신 측: 마지막 패킷에서 갱신된 스탯 (OnRep에서 사용)
+    uint64 ReceivedMask = 0;
+
+    void Capture(const FDRStatAggregator& Stats)
+    {
+        for (int32 i = 0; i < NumStats; ++i)
+        {
+            Values[i] = Stats.GetBase((EDRStat)i);
+        }
+    }
+
+    bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms);
+};
+
+template<>
+struct TStructOpsTypeTraits<FDRReplicatedBaseStats> : public TStructOpsTypeTraitsBase2<FDRReplicatedBaseStats>
+{
+    enum { WithNetDeltaSerializer = true };
+};